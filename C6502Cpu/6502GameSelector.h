@@ -42,39 +42,22 @@ static const SELECTOR s_gameSelector[] PROGMEM = {
     {"T-777   (5)     ",  onSelectGame,    (void*) (CTomahawk777Game::createInstanceSet5),            false},
     {"T-777   (5) clk ",  onSelectGame,    (void*) (CTomahawk777Game::createInstanceClockMasterSet5), false},
     {"Asteroids (4)   ",  onSelectGame,    (void*) (CAsteroidsGame::createInstanceSet4),              false},
-    {"Asteroids (4) ck",  onSelectGame,    (void*) (CAsteroidsGame::createInstanceClockMasterSet4),   false},
     {"Asteroids (2)   ",  onSelectGame,    (void*) (CAsteroidsGame::createInstanceSet2),              false},
-    {"Asteroids (2) ck",  onSelectGame,    (void*) (CAsteroidsGame::createInstanceClockMasterSet2),   false},
     {"Asteroids (1)   ",  onSelectGame,    (void*) (CAsteroidsGame::createInstanceSet1),              false},
-    {"Asteroids (1) ck",  onSelectGame,    (void*) (CAsteroidsGame::createInstanceClockMasterSet1),   false},
     {"AstDlx (3)      ",  onSelectGame,    (void*) (CAsteroidsDeluxeGame::createInstanceSet3),        false},
-    {"AstDlx (3) clk  ",  onSelectGame,    (void*) (CAsteroidsDeluxeGame::createInstanceClockMasterSet3),   false},
-    {"AstDlx (2)      ",  onSelectGame,    (void*) (CAsteroidsDeluxeGame::createInstanceSet2),              false},
-    {"AstDlx (2) clk  ",  onSelectGame,    (void*) (CAsteroidsDeluxeGame::createInstanceClockMasterSet2),   false},
-    {"AstDlx (1)      ",  onSelectGame,    (void*) (CAsteroidsDeluxeGame::createInstanceSet1),              false},
-    {"AstDlx (1) clk  ",  onSelectGame,    (void*) (CAsteroidsDeluxeGame::createInstanceClockMasterSet1),   false},
+    {"AstDlx (2)      ",  onSelectGame,    (void*) (CAsteroidsDeluxeGame::createInstanceSet2),        false},
+    {"AstDlx (1)      ",  onSelectGame,    (void*) (CAsteroidsDeluxeGame::createInstanceSet1),        false},
     {"BattleZone (2)  ",  onSelectGame,    (void*) (CBattlezoneGame::createInstanceSet2),             false},
-    {"BattleZone (2)ck",  onSelectGame,    (void*) (CBattlezoneGame::createInstanceClockMasterSet2),  false},
     {"BattleZone (1)  ",  onSelectGame,    (void*) (CBattlezoneGame::createInstanceSet1),             false},
-    {"BattleZone (1)ck",  onSelectGame,    (void*) (CBattlezoneGame::createInstanceClockMasterSet1),  false},
     {"Centipede (1)   ",  onSelectGame,    (void*) (CCentipedeGame::createInstanceSet1),              false},
-    {"Centipede (1) ck",  onSelectGame,    (void*) (CCentipedeGame::createInstanceClockMasterSet2),   false},
     {"Centipede (2)   ",  onSelectGame,    (void*) (CCentipedeGame::createInstanceSet2),              false},
-    {"Centipede (2) ck",  onSelectGame,    (void*) (CCentipedeGame::createInstanceClockMasterSet3),   false},
     {"Centipede (3)   ",  onSelectGame,    (void*) (CCentipedeGame::createInstanceSet3),              false},
-    {"Centipede (3) ck",  onSelectGame,    (void*) (CCentipedeGame::createInstanceClockMasterSet4),   false},
     {"Centipede (4)   ",  onSelectGame,    (void*) (CCentipedeGame::createInstanceSet4),              false},
-    {"Centipede (4) ck",  onSelectGame,    (void*) (CCentipedeGame::createInstanceClockMasterSet1),   false},
     {"LLander (2)     ",  onSelectGame,    (void*) (CLunarLanderGame::createInstanceSet2),            false},
-    {"LLander (2) clk ",  onSelectGame,    (void*) (CLunarLanderGame::createInstanceClockMasterSet2), false},
     {"LLander (1)     ",  onSelectGame,    (void*) (CLunarLanderGame::createInstanceSet1),            false},
-    {"LLander (1) clk ",  onSelectGame,    (void*) (CLunarLanderGame::createInstanceClockMasterSet1), false},
     {"Millipede       ",  onSelectGame,    (void*) (CMillipedeGame::createInstanceSet1),              false},
-    {"Millipede clk   ",  onSelectGame,    (void*) (CMillipedeGame::createInstanceClockMasterSet1),   false},
     {"SpaceDuel (2)   ",  onSelectGame,    (void*) (CSpaceDuelGame::createInstanceSet2),              false},
-    {"SpaceDuel (2) ck",  onSelectGame,    (void*) (CSpaceDuelGame::createInstanceClockMasterSet2),   false},
     {"SpaceDuel (1)   ",  onSelectGame,    (void*) (CSpaceDuelGame::createInstanceSet1),              false},
-    {"SpaceDuel (1) ck",  onSelectGame,    (void*) (CSpaceDuelGame::createInstanceClockMasterSet1),   false},
     { 0, 0 }
 };
 
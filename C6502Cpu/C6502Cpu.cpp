@@ -118,24 +118,13 @@ C6502Cpu::check(
         CHECK_BUS_VALUE_UINT8_EXIT(error, m_busD, s_D_iot, 0xFF);
     }
 
-    // Loop to detect a clock by sampling and detecting both high and lows.
+    // Detect a clock by sampling and detecting both high and lows.
     {
         UINT16 hiCount = 0;
         UINT16 loCount = 0;
+        UINT16 edgeCount = 0;
 
-        for (int i = 0 ; i < 1000 ; i++)
-        {
-            int value = ::digitalRead(g_pinMap40DIL[s_CLK0i_i.pin]);
-
-            if (value == LOW)
-            {
-                loCount++;
-            }
-            else
-            {
-                hiCount++;
-            }
-        }
+        sampleClock(&hiCount, &loCount, &edgeCount);
 
         if (loCount == 0)
         {
@@ -152,6 +141,80 @@ Exit:
 }
 
 
+//
+// Sample CLK0 a number of times, counting the highs, the lows and the changes between them.
+// A loop at a fixed rate would alias with the board clock - near a whole number of clock
+// periods every sample lands at the same point in the cycle - so each sample is put off
+// by a pseudo-random few microseconds, several periods of a 1 - 2MHz clock.
+//
+void
+C6502Cpu::sampleClock(
+    UINT16 *hiCount,
+    UINT16 *loCount,
+    UINT16 *edgeCount
+)
+{
+    int last = ::digitalRead(g_pinMap40DIL[s_CLK0i_i.pin]);
+    UINT8 jitter = 0xA5;
+
+    *hiCount = 0;
+    *loCount = 0;
+    *edgeCount = 0;
+
+    for (int i = 0 ; i < 1000 ; i++)
+    {
+        int value;
+
+        // 8-bit Galois LFSR - cheaper than random() and only the spread matters.
+        jitter = (jitter >> 1) ^ ((jitter & 1) ? 0xB8 : 0x00);
+        delayMicroseconds(jitter & 0x07);
+
+        value = ::digitalRead(g_pinMap40DIL[s_CLK0i_i.pin]);
+
+        if (value != last)
+        {
+            (*edgeCount)++;
+            last = value;
+        }
+
+        if (value == LOW)
+        {
+            (*loCount)++;
+        }
+        else
+        {
+            (*hiCount)++;
+        }
+    }
+}
+
+
+//
+// A clock is plenty of highs, lows and changes on CLK0. The jittered samples fall at
+// random points of the board clock's cycle, so a clock gives about half high and half
+// changes. A pin held at either level, or a floating pin picking up the odd glitch, is
+// no clock.
+//
+bool
+C6502Cpu::clockDetected(
+)
+{
+    static const UINT16 c_minLevelCount = 100;
+    static const UINT16 c_minEdgeCount  = 100;
+    UINT16 hiCount;
+    UINT16 loCount;
+    UINT16 edgeCount;
+
+    pinMode(g_pinMap40DIL[s_CLK0i_i.pin], INPUT);
+
+    sampleClock(&hiCount, &loCount, &edgeCount);
+
+    return ((hiCount >= c_minLevelCount) &&
+            (loCount >= c_minLevelCount) &&
+            (edgeCount >= c_minEdgeCount));
+}
+
+
 UINT8
 C6502Cpu::dataBusWidth(
     UINT32 address
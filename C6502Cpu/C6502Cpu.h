@@ -105,8 +105,27 @@ class C6502Cpu : public ICpu
         // C6502Cpu Interface
         //
 
+        //
+        // True if the board is supplying a clock on CLK0, sampled with the pin as an
+        // input. Without one the ICT has to be the clock master (C6502ClockMasterCpu),
+        // so the games pick their CPU with this when they're selected. The pin is left
+        // an input.
+        //
+        static
+        bool
+        clockDetected(
+        );
+
     private:
 
+        static
+        void
+        sampleClock(
+            UINT16 *hiCount,
+            UINT16 *loCount,
+            UINT16 *edgeCount
+        );
+
         bool          m_dataBusCheck;
 
         CBus          m_busA;
@@ -23,8 +23,6 @@
 // EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //
 #include "CAsteroidsBaseGame.h"
-#include "C6502Cpu.h"
-#include "C6502ClockMasterCpu.h"
 
 //D2 & E2 together cover 0000-03FF - D2 lower E2 upper
 //0000-01FF D0 -> D7 Zero and one page RAM - RW
@@ -45,72 +43,21 @@
 
 
 CAsteroidsBaseGame::CAsteroidsBaseGame(
-    const bool          clockMaster,
     const ROM_REGION    *romRegion,
+    const ROM_SET       *romSet,
     const RAM_REGION    *ramRegion,
     const RAM_REGION    *ramRegionByteOnly,
     const RAM_REGION    *ramRegionWriteOnly,
     const INPUT_REGION  *inputRegion,
     const OUTPUT_REGION *outputRegion,
     const CUSTOM_FUNCTION *customFunction
-) : CGame( romRegion,
-           ramRegion,
-           ramRegionByteOnly,
-           ramRegionWriteOnly,
-           inputRegion,
-           outputRegion,
-           customFunction )
+) : CAtari6502Game( romRegion,
+                    romSet,
+                    ramRegion,
+                    ramRegionByteOnly,
+                    ramRegionWriteOnly,
+                    inputRegion,
+                    outputRegion,
+                    customFunction )
 {
-    if (clockMaster)
-    {
-        m_cpu = new C6502ClockMasterCpu(false);
-    }
-    else
-    {
-        m_cpu = new C6502Cpu(false);
-    }
-
-    m_cpu->idle();
-    
-    m_interrupt = ICpu::NMI;
-    m_interruptAutoVector = true; // 6502 interrupt is based on an internal vector
-}
-
-
-CAsteroidsBaseGame::~CAsteroidsBaseGame(
-)
-{
-    delete m_cpu;
-    m_cpu = (ICpu *) NULL;
-}
-
-//
-// Interrupt Test
-//
-// IRQ - not used
-// NMI - fires every 4 ms; cleared automatically
-//
-PERROR
-CAsteroidsBaseGame::interruptCheck(
-)
-{
-    UINT16 maxLoops = 10;
-    PERROR error = errorSuccess;
-    
-    // repeat test a few times
-    for (UINT16 i = 0 ; i < maxLoops ; i++)
-    {
-        // Wait up to 10ms for NMI to be active
-        error = m_cpu->waitForInterrupt(m_interrupt, true, 10);
-        if (SUCCESS(error))
-        {
-            // Wait up to 10ms for NMI to be inactive
-            error = m_cpu->waitForInterrupt(m_interrupt, false, 10);
-        }
-        if (FAILED(error))
-        {
-            break;
-        }
-    }
-    return error;
 }
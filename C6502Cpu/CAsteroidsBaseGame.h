@@ -25,40 +25,26 @@
 #ifndef CAsteroidsBaseGame_h
 #define CAsteroidsBaseGame_h
 
-#include "CGame.h"
+#include "CAtari6502Game.h"
 
-
-class CAsteroidsBaseGame : public CGame
+//
+// NMI fires every 4 ms and is cleared automatically. IRQ is not used.
+//
+class CAsteroidsBoard : public CAtari6502Board
 {
     public:
-    
-        PERROR interruptCheck(
-        );
-    
-        //Bit masks - used to test inputs etc by masking / selecting specific bits of data
-        static const UINT32 s_MSK_D0 = 0x01;
-        static const UINT32 s_MSK_D1 = 0x02;
-        static const UINT32 s_MSK_D2 = 0x04;
-        static const UINT32 s_MSK_D3 = 0x08;
-        static const UINT32 s_MSK_D4 = 0x10;
-        static const UINT32 s_MSK_D5 = 0x20;
-        static const UINT32 s_MSK_D6 = 0x40;
-        static const UINT32 s_MSK_D7 = 0x80;
-    
-        static const UINT32 s_MSK_D0_TO_D3 = 0x0F;
-        static const UINT32 s_MSK_D2_TO_D5 = 0x3C;
-        static const UINT32 s_MSK_D6_D7 = 0xC0;
-    
-        static const UINT32 s_MSK_ALL = 0xFF;
-    
-        static const UINT32 s_ACT_Hi = 0x00; //Active High
-        static const UINT32 s_ACT_Lo = 0x01; //Active Low
-   
+
+        static const ICpu::Interrupt c_interrupt = ICpu::NMI;
+        static const UINT8  c_interruptLoops = 10;
+};
+
+class CAsteroidsBaseGame : public CAtari6502Game<CAsteroidsBoard>
+{
     protected:
 
         CAsteroidsBaseGame(
-            const bool          clockMaster,
             const ROM_REGION    *romRegion,
+            const ROM_SET       *romSet,
             const RAM_REGION    *ramRegion,
             const RAM_REGION    *ramRegionByteOnly,
             const RAM_REGION    *ramRegionWriteOnly,
@@ -67,9 +53,6 @@ class CAsteroidsBaseGame : public CGame
             const CUSTOM_FUNCTION *customFunction
         );
 
-        ~CAsteroidsBaseGame(
-        );
-
 };
 
 #endif
@@ -102,6 +102,15 @@ static const ROM_REGION s_romRegionSet1[] PROGMEM = { //
     {NO_BANK_SWITCH, s_ROM_ADDR_J1,  s_ROM_2716_SIZE, s_romData_1_J1,  0xef09bac7, "J1 "}, //J1  -  v1
     {0} }; // end of list
 
+//
+// All the sets above - used to identify the installed set from the 2^n data samples
+//
+static const ROM_SET s_romSet[] PROGMEM = { //"0123456789"
+    {s_romRegionSet3,  "AstDlx 3  "},
+    {s_romRegionSet2,  "AstDlx 2  "},
+    {s_romRegionSet1,  "AstDlx 1  "},
+    {0} }; // end of list
+
 //
 // RAM regions for Asteroids Deluxe are the same as Asteroids, but chip locations are different
 //
@@ -139,15 +148,6 @@ static const RAM_REGION s_ramRegionByteOnly[] PROGMEM = { //
 //
 static const RAM_REGION s_ramRegionWriteOnly[] PROGMEM = { {0} }; // end of list
 
-//
-// hardware addresses
-//
-static const UINT32 s_EAROM_WRITE_ADDR = 0x3200;
-static const UINT32 s_EAROM_CONTROL_ADDR = 0x3a00;
-static const UINT32 s_EAROM_READ_ADDR = 0x2c40;
-static const UINT32 s_P1START_ADDRESS = 0x2403;  // address for P1START to confirm destructive EAROM operations
-static const UINT32 s_P1START_MASK = CAsteroidsBaseGame::s_MSK_D7; // bitmask for P1START
-
 //
 // Input region is the same for all ROM versions.
 //
@@ -156,39 +156,39 @@ static const INPUT_REGION s_inputRegion[] PROGMEM = { //     "012", "012345"
     // 0x2c40 A0-A5 EAROM READ
 
     // CLOCK/CONTROL INPUTS
-    {NO_BANK_SWITCH, 0x2001,  CAsteroidsBaseGame::s_MSK_D7,  "L10", "3KHZ  "}, // L10 - pin 3
-    {NO_BANK_SWITCH, 0x2002,  CAsteroidsBaseGame::s_MSK_D7,  "L10", "HALT  "}, // L10 - pin 2
+    {NO_BANK_SWITCH, 0x2001,  CAtari6502BaseGame::s_MSK_D7,  "L10", "3KHZ  "}, // L10 - pin 3
+    {NO_BANK_SWITCH, 0x2002,  CAtari6502BaseGame::s_MSK_D7,  "L10", "HALT  "}, // L10 - pin 2
     
     // PLAYER INPUTS
-    {NO_BANK_SWITCH, 0x2003,  CAsteroidsBaseGame::s_MSK_D7,  "L10", "SHIELD"}, // L10 - pin 1
-    {NO_BANK_SWITCH, 0x2004,  CAsteroidsBaseGame::s_MSK_D7,  "L10", "FIRE  "}, // L10 - pin 15
+    {NO_BANK_SWITCH, 0x2003,  CAtari6502BaseGame::s_MSK_D7,  "L10", "SHIELD"}, // L10 - pin 1
+    {NO_BANK_SWITCH, 0x2004,  CAtari6502BaseGame::s_MSK_D7,  "L10", "FIRE  "}, // L10 - pin 15
     
     // TEST INPUTS
-    {NO_BANK_SWITCH, 0x2005,  CAsteroidsBaseGame::s_MSK_D7,  "L10", "DIASTP"}, // L10 - pin 14
-    {NO_BANK_SWITCH, 0x2006,  CAsteroidsBaseGame::s_MSK_D7,  "L10", "SLAM  "}, // L10 - pin 13
-    {NO_BANK_SWITCH, 0x2007,  CAsteroidsBaseGame::s_MSK_D7,  "L10", "SLFTST"}, // L10 - pin 12
+    {NO_BANK_SWITCH, 0x2005,  CAtari6502BaseGame::s_MSK_D7,  "L10", "DIASTP"}, // L10 - pin 14
+    {NO_BANK_SWITCH, 0x2006,  CAtari6502BaseGame::s_MSK_D7,  "L10", "SLAM  "}, // L10 - pin 13
+    {NO_BANK_SWITCH, 0x2007,  CAtari6502BaseGame::s_MSK_D7,  "L10", "SLFTST"}, // L10 - pin 12
     
     // COIN INPUTS
-    {NO_BANK_SWITCH, 0x2400,  CAsteroidsBaseGame::s_MSK_D7,  "J10", "COIN L"}, // J10 - pin 4
-    {NO_BANK_SWITCH, 0x2401,  CAsteroidsBaseGame::s_MSK_D7,  "J10", "COIN C"}, // J10 - pin 3
-    {NO_BANK_SWITCH, 0x2402,  CAsteroidsBaseGame::s_MSK_D7,  "J10", "COIN R"}, // J10 - pin 2
+    {NO_BANK_SWITCH, 0x2400,  CAtari6502BaseGame::s_MSK_D7,  "J10", "COIN L"}, // J10 - pin 4
+    {NO_BANK_SWITCH, 0x2401,  CAtari6502BaseGame::s_MSK_D7,  "J10", "COIN C"}, // J10 - pin 3
+    {NO_BANK_SWITCH, 0x2402,  CAtari6502BaseGame::s_MSK_D7,  "J10", "COIN R"}, // J10 - pin 2
     
     // MORE PLAYER INPUTS
-    {NO_BANK_SWITCH, 0x2403,  CAsteroidsBaseGame::s_MSK_D7,  "J10", "1PLYST"}, // J10 - pin 1
-    {NO_BANK_SWITCH, 0x2404,  CAsteroidsBaseGame::s_MSK_D7,  "J10", "2PLYST"}, // J10 - pin 15
-    {NO_BANK_SWITCH, 0x2405,  CAsteroidsBaseGame::s_MSK_D7,  "J10", "THRUST"}, // J10 - pin 14
-    {NO_BANK_SWITCH, 0x2406,  CAsteroidsBaseGame::s_MSK_D7,  "J10", "ROT R "}, // J10 - pin 13
-    {NO_BANK_SWITCH, 0x2407,  CAsteroidsBaseGame::s_MSK_D7,  "J10", "ROT L "}, // J10 - pin 12
+    {NO_BANK_SWITCH, 0x2403,  CAtari6502BaseGame::s_MSK_D7,  "J10", "1PLYST"}, // J10 - pin 1
+    {NO_BANK_SWITCH, 0x2404,  CAtari6502BaseGame::s_MSK_D7,  "J10", "2PLYST"}, // J10 - pin 15
+    {NO_BANK_SWITCH, 0x2405,  CAtari6502BaseGame::s_MSK_D7,  "J10", "THRUST"}, // J10 - pin 14
+    {NO_BANK_SWITCH, 0x2406,  CAtari6502BaseGame::s_MSK_D7,  "J10", "ROT R "}, // J10 - pin 13
+    {NO_BANK_SWITCH, 0x2407,  CAtari6502BaseGame::s_MSK_D7,  "J10", "ROT L "}, // J10 - pin 12
     
     // DIP SWITCH INPUTS
-    {NO_BANK_SWITCH, 0x2803,  CAsteroidsBaseGame::s_MSK_D0,  "P5 ", "SW1   "}, // P5 - pin 3
-    {NO_BANK_SWITCH, 0x2803,  CAsteroidsBaseGame::s_MSK_D1,  "P5 ", "SW2   "}, // P5 - pin 13
-    {NO_BANK_SWITCH, 0x2802,  CAsteroidsBaseGame::s_MSK_D0,  "P5 ", "SW3   "}, // P5 - pin 4
-    {NO_BANK_SWITCH, 0x2802,  CAsteroidsBaseGame::s_MSK_D1,  "P5 ", "SW4   "}, // P5 - pin 12
-    {NO_BANK_SWITCH, 0x2801,  CAsteroidsBaseGame::s_MSK_D0,  "P5 ", "SW5   "}, // P5 - pin 5
-    {NO_BANK_SWITCH, 0x2801,  CAsteroidsBaseGame::s_MSK_D1,  "P5 ", "SW6   "}, // P5 - pin 11
-    {NO_BANK_SWITCH, 0x2800,  CAsteroidsBaseGame::s_MSK_D0,  "P5 ", "SW7   "}, // P5 - pin 6
-    {NO_BANK_SWITCH, 0x2800,  CAsteroidsBaseGame::s_MSK_D1,  "P5 ", "SW8   "}, // P5 - pin 10
+    {NO_BANK_SWITCH, 0x2803,  CAtari6502BaseGame::s_MSK_D0,  "P5 ", "SW1   "}, // P5 - pin 3
+    {NO_BANK_SWITCH, 0x2803,  CAtari6502BaseGame::s_MSK_D1,  "P5 ", "SW2   "}, // P5 - pin 13
+    {NO_BANK_SWITCH, 0x2802,  CAtari6502BaseGame::s_MSK_D0,  "P5 ", "SW3   "}, // P5 - pin 4
+    {NO_BANK_SWITCH, 0x2802,  CAtari6502BaseGame::s_MSK_D1,  "P5 ", "SW4   "}, // P5 - pin 12
+    {NO_BANK_SWITCH, 0x2801,  CAtari6502BaseGame::s_MSK_D0,  "P5 ", "SW5   "}, // P5 - pin 5
+    {NO_BANK_SWITCH, 0x2801,  CAtari6502BaseGame::s_MSK_D1,  "P5 ", "SW6   "}, // P5 - pin 11
+    {NO_BANK_SWITCH, 0x2800,  CAtari6502BaseGame::s_MSK_D0,  "P5 ", "SW7   "}, // P5 - pin 6
+    {NO_BANK_SWITCH, 0x2800,  CAtari6502BaseGame::s_MSK_D1,  "P5 ", "SW8   "}, // P5 - pin 10
     {0}
 }; // end of list
 
@@ -211,26 +211,26 @@ static const OUTPUT_REGION s_outputRegion[] PROGMEM = { //
     // 9     0x3E00                               _NOISESRESET Noise generator reset
 
     //                                                                                     "012", "012345"
-    {NO_BANK_SWITCH, 0x3000, CAsteroidsBaseGame::s_MSK_ALL, CAsteroidsBaseGame::s_ACT_Lo,  "L5 ", "DMAGO "}, // DMAGO, L5 - pin 1
+    {NO_BANK_SWITCH, 0x3000, CAtari6502BaseGame::s_MSK_ALL, CAtari6502BaseGame::s_ACT_Lo,  "L5 ", "DMAGO "}, // DMAGO, L5 - pin 1
     // 0x3200-0x33ff - EAROM Latches - not implemented
-    {NO_BANK_SWITCH, 0x3400, CAsteroidsBaseGame::s_MSK_ALL, CAsteroidsBaseGame::s_ACT_Lo,  "L5 ", "WD CLR"}, // WATCHDOG CLEAR, L5 - pin 3 
+    {NO_BANK_SWITCH, 0x3400, CAtari6502BaseGame::s_MSK_ALL, CAtari6502BaseGame::s_ACT_Lo,  "L5 ", "WD CLR"}, // WATCHDOG CLEAR, L5 - pin 3 
 
-    {NO_BANK_SWITCH, 0x3600, CAsteroidsBaseGame::s_MSK_D6_D7,    CAsteroidsBaseGame::s_ACT_Hi,  "P6 ", "EXPPIT"}, //EXPLOSION PITCH, P6 D6-D7
-    {NO_BANK_SWITCH, 0x3600, CAsteroidsBaseGame::s_MSK_D2_TO_D5, CAsteroidsBaseGame::s_ACT_Hi,  "P6 ", "EXPVOL"}, //EXPLOSION VOLUME, P6 D2-D5
+    {NO_BANK_SWITCH, 0x3600, CAtari6502BaseGame::s_MSK_D6_D7,    CAtari6502BaseGame::s_ACT_Hi,  "P6 ", "EXPPIT"}, //EXPLOSION PITCH, P6 D6-D7
+    {NO_BANK_SWITCH, 0x3600, CAtari6502BaseGame::s_MSK_D2_TO_D5, CAtari6502BaseGame::s_ACT_Hi,  "P6 ", "EXPVOL"}, //EXPLOSION VOLUME, P6 D2-D5
 
-    {NO_BANK_SWITCH, 0x3800, CAsteroidsBaseGame::s_MSK_ALL, CAsteroidsBaseGame::s_ACT_Lo,  "L5 ", "DMARST"}, // DMARESET, L5 - pin 5
+    {NO_BANK_SWITCH, 0x3800, CAtari6502BaseGame::s_MSK_ALL, CAtari6502BaseGame::s_ACT_Lo,  "L5 ", "DMARST"}, // DMARESET, L5 - pin 5
  
     // 0x3c00-0x3c07 enables M10, a 74LS259 8-bit addressable latch (data on D7)
-    {NO_BANK_SWITCH, 0x3C00, CAsteroidsBaseGame::s_MSK_D7,  CAsteroidsBaseGame::s_ACT_Lo,  "M10", "1P LMP"}, // PLAYER 1 LAMP, M10 - pin 4
-    {NO_BANK_SWITCH, 0x3C01, CAsteroidsBaseGame::s_MSK_D7,  CAsteroidsBaseGame::s_ACT_Lo,  "M10", "2P LMP"}, // PLAYER 2 LAMP, M10 - pin 5
+    {NO_BANK_SWITCH, 0x3C00, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Lo,  "M10", "1P LMP"}, // PLAYER 1 LAMP, M10 - pin 4
+    {NO_BANK_SWITCH, 0x3C01, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Lo,  "M10", "2P LMP"}, // PLAYER 2 LAMP, M10 - pin 5
     // 0x3C02 - no connection
-    {NO_BANK_SWITCH, 0x3C03, CAsteroidsBaseGame::s_MSK_D7,  CAsteroidsBaseGame::s_ACT_Hi,  "M10", "THR EN"}, // SHIPTHRUSTEN, M10 - pin 7
-    {NO_BANK_SWITCH, 0x3C04, CAsteroidsBaseGame::s_MSK_D7,  CAsteroidsBaseGame::s_ACT_Hi,  "M10", "RAMSEL"}, // RAM SELECT, M10 - pin 9
-    {NO_BANK_SWITCH, 0x3C05, CAsteroidsBaseGame::s_MSK_D7,  CAsteroidsBaseGame::s_ACT_Hi,  "M10", "CNCTLT"}, // COIN COUNTER LEFT, M10 - pin 10
-    {NO_BANK_SWITCH, 0x3C06, CAsteroidsBaseGame::s_MSK_D7,  CAsteroidsBaseGame::s_ACT_Hi,  "M10", "CNCTCT"}, // COIN COUNTER MIDDLE, M10 - pin 11
-    {NO_BANK_SWITCH, 0x3C07, CAsteroidsBaseGame::s_MSK_D7,  CAsteroidsBaseGame::s_ACT_Hi,  "M10", "CNCTRT"}, // COIN COUNTER RIGHT, M10 - pin 12
+    {NO_BANK_SWITCH, 0x3C03, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Hi,  "M10", "THR EN"}, // SHIPTHRUSTEN, M10 - pin 7
+    {NO_BANK_SWITCH, 0x3C04, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Hi,  "M10", "RAMSEL"}, // RAM SELECT, M10 - pin 9
+    {NO_BANK_SWITCH, 0x3C05, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Hi,  "M10", "CNCTLT"}, // COIN COUNTER LEFT, M10 - pin 10
+    {NO_BANK_SWITCH, 0x3C06, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Hi,  "M10", "CNCTCT"}, // COIN COUNTER MIDDLE, M10 - pin 11
+    {NO_BANK_SWITCH, 0x3C07, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Hi,  "M10", "CNCTRT"}, // COIN COUNTER RIGHT, M10 - pin 12
 
-    {NO_BANK_SWITCH, 0x3E00, CAsteroidsBaseGame::s_MSK_ALL, CAsteroidsBaseGame::s_ACT_Lo,  "R8 ", "NSERST"}, // NOISE RESET, R8   
+    {NO_BANK_SWITCH, 0x3E00, CAtari6502BaseGame::s_MSK_ALL, CAtari6502BaseGame::s_ACT_Lo,  "R8 ", "NSERST"}, // NOISE RESET, R8   
     {0}
 }; // end of list
 
@@ -239,159 +239,54 @@ static const OUTPUT_REGION s_outputRegion[] PROGMEM = { //
 //
 static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = {
     //                                      "0123456789"
-    {CAsteroidsDeluxeGame::earomReadTest,   "EAROM Read"},
-    {CAsteroidsDeluxeGame::earomSerialDump, "EAROM Dump"},
-    {CAsteroidsDeluxeGame::earomSerialLoad, "EAROM Load"},
-    {CAsteroidsDeluxeGame::earomErase,      "EAROM Wipe"},
+    {CAtari6502BaseGame::earomReadTest,     "EAROM Read"},
+    {CAtari6502BaseGame::earomSerialDump,   "EAROM Dump"},
+    {CAtari6502BaseGame::earomSerialLoad,   "EAROM Load"},
+    {CAtari6502BaseGame::earomErase,        "EAROM Wipe"},
+    {CAtari6502BaseGame::romIdentify,       "ROM Ident "},
+    {CAtari6502BaseGame::romVerify,         "ROM BlkMap"},
+    {CAtari6502BaseGame::romVerifyFirstBlock, "ROM Blk1st"},
+    {CAtari6502BaseGame::romSample,           "ROM Sample"},
+    {CAtari6502BaseGame::romQuick,            "ROM Quick "},
+    {CAtari6502BaseGame::romDump,             "ROM Dump  "},
+    {CAtari6502BaseGame::romCompare,          "ROM Comp  "},
+    {CAtari6502BaseGame::romLearn,            "ROM Learn "},
+    {CAtari6502BaseGame::romLearnLayout,      "ROM Layout"},
+    {CAtari6502BaseGame::romChecksum,         "ROM Cksum "},
+    {CCrc32::benchmark,                     "CRC Bench "},
     {NO_CUSTOM_FUNCTION} // end of list
 };
 
-//
-// Basic EAROM read test
-//
-PERROR
-CAsteroidsDeluxeGame::earomReadTest(
-                                  void *cAsteroidsDeluxeGame
-                                  )
-{
-    CAsteroidsDeluxeGame *pThis = (CAsteroidsDeluxeGame *) cAsteroidsDeluxeGame;
-    PERROR error = errorSuccess;
-    error = pThis->m_earom->readTest();
-    return error;
-}
-
-//
-// Erase all contents of EAROM
-// WARNING: Clears all high scores, and uses up 64 of the EAROM's 1 million rated write cycles
-//
-PERROR
-CAsteroidsDeluxeGame::earomErase(
-                               void *cAsteroidsDeluxeGame
-                               )
-{
-    CAsteroidsDeluxeGame *pThis = (CAsteroidsDeluxeGame *) cAsteroidsDeluxeGame;
-    PERROR error = errorSuccess;
-    
-    error = pThis->confirmWithP1Start(); // only proceed if player 1 start button is pressed
-    if (SUCCESS(error))
-    {
-        error = pThis->m_earom->erase();
-    }
-    return error;
-}
-
-//
-// Dump contents of EAROM to serial port as hex bytes
-//
-PERROR
-CAsteroidsDeluxeGame::earomSerialDump(
-                                      void *cAsteroidsDeluxeGame
-                                      )
-{
-    CAsteroidsDeluxeGame *pThis = (CAsteroidsDeluxeGame *) cAsteroidsDeluxeGame;
-    PERROR error = errorSuccess;
-    error = pThis->m_earom->serialDump();
-    return error;
-}
-
-//
-// Rewrite EAROM from hex bytes on serial port
-//
-PERROR
-CAsteroidsDeluxeGame::earomSerialLoad(
-                                      void *cAsteroidsDeluxeGame
-                                      )
-{
-    CAsteroidsDeluxeGame *pThis = (CAsteroidsDeluxeGame *) cAsteroidsDeluxeGame;
-    PERROR error = errorSuccess;
-    
-    error = pThis->confirmWithP1Start(); // only proceed if player 1 start button is pressed
-    if SUCCESS(error)
-    {
-        error = pThis->m_earom->serialLoad();
-    }
-    return error;
-}
-
-//
-// Require the user to hold down P1 Start when initiating a destructive EAROM operation
-//
-PERROR
-CAsteroidsDeluxeGame::confirmWithP1Start()
-{
-    PERROR error = errorSuccess;
-    UINT16 data16 = 0;
-    
-    error = this->m_cpu->memoryRead(s_P1START_ADDRESS, &data16);
-    if ( FAILED(error) || !(data16 & (UINT16)s_P1START_MASK) ) // active high
-        {
-            error = errorCustom;
-            error->code = ERROR_FAILED;
-            error->description = "E:Hold P1START";
-        }
-    return error;
-}
-
 IGame*
 CAsteroidsDeluxeGame::createInstanceSet3(
 )
 {
-    return (new CAsteroidsDeluxeGame(false, s_romRegionSet3));
-}
-
-IGame*
-CAsteroidsDeluxeGame::createInstanceClockMasterSet3(
-)
-{
-    return (new CAsteroidsDeluxeGame(true, s_romRegionSet3));
+    return (new CAsteroidsDeluxeGame(s_romRegionSet3));
 }
 
 IGame*
 CAsteroidsDeluxeGame::createInstanceSet2(
 )
 {
-    return (new CAsteroidsDeluxeGame(false, s_romRegionSet2));
-}
-
-IGame*
-CAsteroidsDeluxeGame::createInstanceClockMasterSet2(
-)
-{
-    return (new CAsteroidsDeluxeGame(true, s_romRegionSet2));
+    return (new CAsteroidsDeluxeGame(s_romRegionSet2));
 }
 
 IGame*
 CAsteroidsDeluxeGame::createInstanceSet1(
 )
 {
-    return (new CAsteroidsDeluxeGame(false, s_romRegionSet1));
-}
-
-IGame*
-CAsteroidsDeluxeGame::createInstanceClockMasterSet1(
-)
-{
-    return (new CAsteroidsDeluxeGame(true, s_romRegionSet1));
+    return (new CAsteroidsDeluxeGame(s_romRegionSet1));
 }
 
 CAsteroidsDeluxeGame::CAsteroidsDeluxeGame(
-                               const bool       clockMaster,
                                const ROM_REGION *romRegion
-                               ) : CAsteroidsBaseGame( clockMaster,
-                                                      romRegion,
-                                                      s_ramRegion,
-                                                      s_ramRegionByteOnly,
-                                                      s_ramRegionWriteOnly,
-                                                      s_inputRegion,
-                                                      s_outputRegion,
-                                                      s_customFunction )
-{
-    m_earom = new CER2055(m_cpu, s_EAROM_WRITE_ADDR, s_EAROM_CONTROL_ADDR, s_EAROM_READ_ADDR, EAROM_C1D2_C2D1);
-}
-
-CAsteroidsDeluxeGame::~CAsteroidsDeluxeGame(
-)
+                               ) : CAtari6502Game( romRegion,
+                                                   s_romSet,
+                                                   s_ramRegion,
+                                                   s_ramRegionByteOnly,
+                                                   s_ramRegionWriteOnly,
+                                                   s_inputRegion,
+                                                   s_outputRegion,
+                                                   s_customFunction )
 {
-    delete m_earom;
-    m_earom = (CER2055 *) NULL;
 }
@@ -25,9 +25,24 @@
 #ifndef CAsteroidsDeluxeGame_h
 #define CAsteroidsDeluxeGame_h
 #include "CAsteroidsBaseGame.h"
-#include "CER2055.h"
 
-class CAsteroidsDeluxeGame : public CAsteroidsBaseGame
+//
+// Asteroids with an ER2055 EAROM for the high scores. P1 START is active high.
+//
+class CAsteroidsDeluxeBoard : public CAsteroidsBoard
+{
+    public:
+
+        static const UINT16 c_earomWriteAddress = 0x3200;
+        static const UINT16 c_earomControlAddress = 0x3a00;
+        static const UINT16 c_earomReadAddress = 0x2c40;
+        static const UINT8  c_earomMapping = EAROM_C1D2_C2D1;
+        static const UINT16 c_earomConfirmAddress = 0x2403;
+        static const UINT8  c_earomConfirmMask = CAtari6502BaseGame::s_MSK_D7;
+        static const bool   c_earomConfirmActiveLow = false;
+};
+
+class CAsteroidsDeluxeGame : public CAtari6502Game<CAsteroidsDeluxeBoard>
 {
     public:
 
@@ -36,21 +51,9 @@ class CAsteroidsDeluxeGame : public CAsteroidsBaseGame
         //
 
         static IGame* createInstanceSet3();
-        static IGame* createInstanceClockMasterSet3();
         static IGame* createInstanceSet2();
-        static IGame* createInstanceClockMasterSet2();
         static IGame* createInstanceSet1();
-        static IGame* createInstanceClockMasterSet1();
 
-        //
-        // custom tests for the EAROM
-        //
-        static PERROR earomReadTest(void *cCentipedeGame);
-        static PERROR earomErase(void *cCentipedeGame);
-        static PERROR earomSerialDump(void *cCentipedeGame);
-        static PERROR earomSerialLoad(void *cCentipedeGame);
-        PERROR confirmDestructiveOperation();
-    
         //
         // IGame Interface - wholly implemented in the Base game.
         //
@@ -61,17 +64,9 @@ class CAsteroidsDeluxeGame : public CAsteroidsBaseGame
         // Different ROM sets supplied.
         //
         CAsteroidsDeluxeGame(
-            const bool       clockMaster,
             const ROM_REGION *romRegion
         );
- 
-        ~CAsteroidsDeluxeGame(
-        );
-
-        PERROR confirmWithP1Start(
-        );
 
-        CER2055 *m_earom;
 };
 
 #endif
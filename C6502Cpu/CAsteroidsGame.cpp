@@ -86,6 +86,15 @@ static const ROM_REGION s_romRegionSet1[] PROGMEM = { //
     {NO_BANK_SWITCH, s_ROM_ADDR_C1,  s_ROM_2716_SIZE, s_romData_1_C1,  0x7D4E3D05, "C1 "}, //J2 -  v1
     {0} }; // end of list
 
+//
+// All the sets above - used to identify the installed set from the 2^n data samples
+//
+static const ROM_SET s_romSet[] PROGMEM = { //"0123456789"
+    {s_romRegionSet4,  "Asteroid 4"},
+    {s_romRegionSet2,  "Asteroid 2"},
+    {s_romRegionSet1,  "Asteroid 1"},
+    {0} }; // end of list
+
 ROM_REGION CAsteroidsGame::getAstRomset4(){ return *s_romRegionSet4; }
 ROM_REGION CAsteroidsGame::getAstRomset2(){ return *s_romRegionSet2; }
 ROM_REGION CAsteroidsGame::getAstRomset1(){ return *s_romRegionSet1; }
@@ -257,6 +266,17 @@ static const OUTPUT_REGION s_outputRegion[] PROGMEM = { //
 //
 static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = {
     //                                         "0123456789"
+    {CAsteroidsBaseGame::romIdentify,          "ROM Ident "},
+    {CAsteroidsBaseGame::romVerify,            "ROM BlkMap"},
+    {CAsteroidsBaseGame::romVerifyFirstBlock,  "ROM Blk1st"},
+    {CAsteroidsBaseGame::romSample,            "ROM Sample"},
+    {CAsteroidsBaseGame::romQuick,             "ROM Quick "},
+    {CAsteroidsBaseGame::romDump,              "ROM Dump  "},
+    {CAsteroidsBaseGame::romCompare,           "ROM Comp  "},
+    {CAsteroidsBaseGame::romLearn,             "ROM Learn "},
+    {CAsteroidsBaseGame::romLearnLayout,       "ROM Layout"},
+    {CAsteroidsBaseGame::romChecksum,          "ROM Cksum "},
+    {CCrc32::benchmark,                        "CRC Bench "},
     {NO_CUSTOM_FUNCTION} // end of list
 };
 
@@ -264,49 +284,27 @@ IGame*
 CAsteroidsGame::createInstanceSet4(
 )
 {
-    return (new CAsteroidsGame(false, s_romRegionSet4));
-}
-
-IGame*
-CAsteroidsGame::createInstanceClockMasterSet4(
-)
-{
-    return (new CAsteroidsGame(true, s_romRegionSet4));
+    return (new CAsteroidsGame(s_romRegionSet4));
 }
 
 IGame*
 CAsteroidsGame::createInstanceSet2(
 )
 {
-    return (new CAsteroidsGame(false, s_romRegionSet2));
-}
-
-IGame*
-CAsteroidsGame::createInstanceClockMasterSet2(
-)
-{
-    return (new CAsteroidsGame(true, s_romRegionSet2));
+    return (new CAsteroidsGame(s_romRegionSet2));
 }
 
 IGame*
 CAsteroidsGame::createInstanceSet1(
 )
 {
-    return (new CAsteroidsGame(false, s_romRegionSet1));
-}
-
-IGame*
-CAsteroidsGame::createInstanceClockMasterSet1(
-)
-{
-    return (new CAsteroidsGame(true, s_romRegionSet1));
+    return (new CAsteroidsGame(s_romRegionSet1));
 }
 
 CAsteroidsGame::CAsteroidsGame(
-                               const bool       clockMaster,
                                const ROM_REGION *romRegion
-                               ) : CAsteroidsBaseGame( clockMaster,
-                                                       romRegion,
+                               ) : CAsteroidsBaseGame( romRegion,
+                                                       s_romSet,
                                                       s_ramRegion,
                                                       s_ramRegionByteOnly,
                                                       s_ramRegionWriteOnly,
@@ -36,11 +36,8 @@ class CAsteroidsGame : public CAsteroidsBaseGame
         //
 
         static IGame* createInstanceSet4();
-        static IGame* createInstanceClockMasterSet4();
         static IGame* createInstanceSet2();
-        static IGame* createInstanceClockMasterSet2();
         static IGame* createInstanceSet1();
-        static IGame* createInstanceClockMasterSet1();
 
         //
         // IGame Interface - wholly implemented in the Base game.
@@ -56,7 +53,6 @@ class CAsteroidsGame : public CAsteroidsBaseGame
         // Different ROM sets supplied.
         //
         CAsteroidsGame(
-            const bool       clockMaster,
             const ROM_REGION *romRegion
         );
 
@@ -0,0 +1,379 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#include "CAtari6502BaseGame.h"
+#include "C6502Cpu.h"
+#include "C6502ClockMasterCpu.h"
+
+//
+// The ICT as clock master, for a board that had no clock when the game was selected. A
+// board clock that starts later (e.g. an intermittent clock fault) means the board runs
+// on its own clock while the ICT times the bus on its, so check() looks again before
+// the pin checks and reports it rather than testing on.
+//
+class CAtari6502ClockMasterCpu : public C6502ClockMasterCpu
+{
+    public:
+
+        CAtari6502ClockMasterCpu(
+            bool dataBusCheck
+        );
+
+        virtual
+        PERROR
+        check(
+        );
+};
+
+CAtari6502ClockMasterCpu::CAtari6502ClockMasterCpu(
+    bool dataBusCheck
+) : C6502ClockMasterCpu(dataBusCheck)
+{
+}
+
+PERROR
+CAtari6502ClockMasterCpu::check(
+)
+{
+    PERROR error = errorSuccess;
+    bool boardClock = C6502Cpu::clockDetected();
+
+    // Put the pins back the way the clock master uses them.
+    idle();
+
+    if (boardClock)
+    {
+        error = errorCustom;
+        error->code = ERROR_FAILED;
+        error->description = "E:Board clock on";
+        return error;
+    }
+
+    return C6502ClockMasterCpu::check();
+}
+
+CAtari6502BaseGame::CAtari6502BaseGame(
+    const ROM_REGION    *romRegion,
+    const ROM_SET       *romSet,
+    const RAM_REGION    *ramRegion,
+    const RAM_REGION    *ramRegionByteOnly,
+    const RAM_REGION    *ramRegionWriteOnly,
+    const INPUT_REGION  *inputRegion,
+    const OUTPUT_REGION *outputRegion,
+    const CUSTOM_FUNCTION *customFunction
+) : CGame( romRegion,
+           ramRegion,
+           ramRegionByteOnly,
+           ramRegionWriteOnly,
+           inputRegion,
+           outputRegion,
+           customFunction ),
+    m_earom((CER2055 *) NULL),
+    m_romSet(romSet),
+    m_checksumRom(0)
+{
+    cpuCreate();
+}
+
+CAtari6502BaseGame::CAtari6502BaseGame(
+    const ROM_DATA2N    *romData2n,
+    const ROM_REGION    *romRegion,
+    const RAM_REGION    *ramRegion,
+    const RAM_REGION    *ramRegionByteOnly,
+    const RAM_REGION    *ramRegionWriteOnly,
+    const INPUT_REGION  *inputRegion,
+    const OUTPUT_REGION *outputRegion,
+    const CUSTOM_FUNCTION *customFunction
+) : CGame( romData2n,
+           romRegion,
+           ramRegion,
+           ramRegionByteOnly,
+           ramRegionWriteOnly,
+           inputRegion,
+           outputRegion,
+           customFunction ),
+    m_earom((CER2055 *) NULL),
+    m_romSet((const ROM_SET *) NULL),
+    m_checksumRom(0)
+{
+    cpuCreate();
+}
+
+CAtari6502BaseGame::~CAtari6502BaseGame(
+)
+{
+    delete m_earom;
+    m_earom = (CER2055 *) NULL;
+
+    delete m_cpu;
+    m_cpu = (ICpu *) NULL;
+}
+
+void
+CAtari6502BaseGame::cpuCreate(
+)
+{
+    if (C6502Cpu::clockDetected())
+    {
+        m_cpu = new C6502Cpu(false);
+    }
+    else
+    {
+        m_cpu = new CAtari6502ClockMasterCpu(false);
+    }
+
+    m_cpu->idle();
+
+    m_interruptAutoVector = true; // 6502 interrupt is based on an internal vector
+}
+
+void
+CAtari6502BaseGame::earomCreate(
+    UINT16 writeBaseAddress,
+    UINT16 controlAddress,
+    UINT16 readAddress,
+    UINT8  C1C2mapping,
+    UINT16 confirmAddress,
+    UINT8  confirmMask,
+    bool   confirmActiveLow
+)
+{
+    m_earom = new CER2055(m_cpu, writeBaseAddress, controlAddress, readAddress, C1C2mapping);
+    m_confirmAddress = confirmAddress;
+    m_confirmMask = confirmMask;
+    m_confirmActiveLow = confirmActiveLow;
+}
+
+//
+// Require the user to hold down the start button when initiating a destructive EAROM operation
+//
+PERROR
+CAtari6502BaseGame::confirmDestructive(
+)
+{
+    return m_earom->confirmOperation(m_confirmAddress,
+                                     m_confirmMask,
+                                     m_confirmActiveLow,
+                                     (String *) NULL);
+}
+
+//
+// Returns EAROM to dormant state (shouldn't really be needed)
+//
+PERROR
+CAtari6502BaseGame::earomIdle(
+                              void *cAtari6502BaseGame
+                              )
+{
+    CAtari6502BaseGame *pThis = (CAtari6502BaseGame *) cAtari6502BaseGame;
+
+    return pThis->m_earom->idle();
+}
+
+//
+// Basic EAROM read test
+//
+PERROR
+CAtari6502BaseGame::earomReadTest(
+                                  void *cAtari6502BaseGame
+                                  )
+{
+    CAtari6502BaseGame *pThis = (CAtari6502BaseGame *) cAtari6502BaseGame;
+
+    return pThis->m_earom->readTest();
+}
+
+//
+// Erase all contents of EAROM
+// WARNING: Clears all high scores, and uses up 64 of the EAROM's 1 million rated write cycles
+//
+PERROR
+CAtari6502BaseGame::earomErase(
+                               void *cAtari6502BaseGame
+                               )
+{
+    CAtari6502BaseGame *pThis = (CAtari6502BaseGame *) cAtari6502BaseGame;
+    PERROR error = errorSuccess;
+
+    error = pThis->confirmDestructive(); // only proceed if the start button is pressed
+    if (SUCCESS(error))
+    {
+        error = pThis->m_earom->erase();
+    }
+    return error;
+}
+
+//
+// Dump contents of EAROM to serial port as hex bytes
+//
+PERROR
+CAtari6502BaseGame::earomSerialDump(
+                                    void *cAtari6502BaseGame
+                                    )
+{
+    CAtari6502BaseGame *pThis = (CAtari6502BaseGame *) cAtari6502BaseGame;
+
+    return pThis->m_earom->serialDump();
+}
+
+//
+// Rewrite EAROM from hex bytes on serial port
+//
+PERROR
+CAtari6502BaseGame::earomSerialLoad(
+                                    void *cAtari6502BaseGame
+                                    )
+{
+    CAtari6502BaseGame *pThis = (CAtari6502BaseGame *) cAtari6502BaseGame;
+    PERROR error = errorSuccess;
+
+    error = pThis->confirmDestructive(); // only proceed if the start button is pressed
+    if (SUCCESS(error))
+    {
+        error = pThis->m_earom->serialLoad();
+    }
+    return error;
+}
+
+//
+// Identify the installed romset from the 2^n data samples of each ROM
+//
+PERROR
+CAtari6502BaseGame::romIdentify(
+                                void *cAtari6502BaseGame
+                                )
+{
+    CAtari6502BaseGame *pThis = (CAtari6502BaseGame *) cAtari6502BaseGame;
+    CRomIdentify romIdentify(pThis->m_cpu, pThis, pThis->m_romSet);
+
+    return romIdentify.identify();
+}
+
+//
+// Verify the ROMs against their block maps to show where a bad ROM fails
+//
+PERROR
+CAtari6502BaseGame::romVerify(
+                              void *cAtari6502BaseGame
+                              )
+{
+    CAtari6502BaseGame *pThis = (CAtari6502BaseGame *) cAtari6502BaseGame;
+    CRomVerify romVerify(pThis->m_cpu, pThis);
+
+    return romVerify.verify(pThis->m_romRegion, false);
+}
+
+PERROR
+CAtari6502BaseGame::romVerifyFirstBlock(
+                                        void *cAtari6502BaseGame
+                                        )
+{
+    CAtari6502BaseGame *pThis = (CAtari6502BaseGame *) cAtari6502BaseGame;
+    CRomVerify romVerify(pThis->m_cpu, pThis);
+
+    return romVerify.verify(pThis->m_romRegion, true);
+}
+
+PERROR
+CAtari6502BaseGame::romSample(
+                              void *cAtari6502BaseGame
+                              )
+{
+    CAtari6502BaseGame *pThis = (CAtari6502BaseGame *) cAtari6502BaseGame;
+    CRomVerify romVerify(pThis->m_cpu, pThis);
+
+    return romVerify.verifySampled(pThis->m_romRegion, false);
+}
+
+PERROR
+CAtari6502BaseGame::romQuick(
+                             void *cAtari6502BaseGame
+                             )
+{
+    CAtari6502BaseGame *pThis = (CAtari6502BaseGame *) cAtari6502BaseGame;
+    CRomVerify romVerify(pThis->m_cpu, pThis);
+
+    return romVerify.verifySampled(pThis->m_romRegion, true);
+}
+
+PERROR
+CAtari6502BaseGame::romDump(
+                            void *cAtari6502BaseGame
+                            )
+{
+    CAtari6502BaseGame *pThis = (CAtari6502BaseGame *) cAtari6502BaseGame;
+    CRomDump romDump(pThis->m_cpu, pThis);
+
+    return romDump.dump(pThis->m_romRegion);
+}
+
+PERROR
+CAtari6502BaseGame::romCompare(
+                               void *cAtari6502BaseGame
+                               )
+{
+    CAtari6502BaseGame *pThis = (CAtari6502BaseGame *) cAtari6502BaseGame;
+    CRomCompare romCompare(pThis->m_cpu, pThis);
+
+    return romCompare.compare(pThis->m_romRegion);
+}
+
+//
+// The game's table is the layout - a new revision keeps the sockets.
+//
+PERROR
+CAtari6502BaseGame::romLearn(
+                             void *cAtari6502BaseGame
+                             )
+{
+    CAtari6502BaseGame *pThis = (CAtari6502BaseGame *) cAtari6502BaseGame;
+    CRomLearn romLearn(pThis->m_cpu, pThis);
+
+    return romLearn.learn(pThis->m_romRegion);
+}
+
+PERROR
+CAtari6502BaseGame::romLearnLayout(
+                                   void *cAtari6502BaseGame
+                                   )
+{
+    CAtari6502BaseGame *pThis = (CAtari6502BaseGame *) cAtari6502BaseGame;
+    CRomLearn romLearn(pThis->m_cpu, pThis);
+
+    return romLearn.learnSerial();
+}
+
+//
+// Read the next ROM for its CRC and the checksums the game's self-test shows
+//
+PERROR
+CAtari6502BaseGame::romChecksum(
+                                void *cAtari6502BaseGame
+                                )
+{
+    CAtari6502BaseGame *pThis = (CAtari6502BaseGame *) cAtari6502BaseGame;
+    CRomVerify romVerify(pThis->m_cpu, pThis);
+
+    return romVerify.checksum(pThis->m_romRegion, &pThis->m_checksumRom);
+}
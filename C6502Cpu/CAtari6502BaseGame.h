@@ -0,0 +1,189 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef CAtari6502BaseGame_h
+#define CAtari6502BaseGame_h
+
+#include "CGame.h"
+#include "CER2055.h"
+#include "CRomIdentify.h"
+#include "CRomVerify.h"
+#include "CRomDump.h"
+#include "CRomCompare.h"
+#include "CRomLearn.h"
+
+//
+// The code common to every Atari 6502 board - the CPU, the ROM tools and the EAROM.
+// A board's interrupt and EAROM wiring are given to CAtari6502Game as a board
+// descriptor (see CAtari6502Game.h) so only those parts are built per board.
+//
+class CAtari6502BaseGame : public CGame
+{
+    public:
+
+        //
+        // Custom tests for the EAROM - boards without one don't list them.
+        //
+        static PERROR earomIdle(
+                                void *cAtari6502BaseGame
+        );
+
+        static PERROR earomReadTest(
+                                    void *cAtari6502BaseGame
+        );
+
+        static PERROR earomErase(
+                                 void *cAtari6502BaseGame
+        );
+
+        static PERROR earomSerialDump(
+                                      void *cAtari6502BaseGame
+        );
+
+        static PERROR earomSerialLoad(
+                                      void *cAtari6502BaseGame
+        );
+
+        static PERROR romIdentify(
+                                  void *cAtari6502BaseGame
+        );
+
+        // Block map ROM verify - whole ROM / stop at the first bad block
+        static PERROR romVerify(
+                                void *cAtari6502BaseGame
+        );
+
+        static PERROR romVerifyFirstBlock(
+                                          void *cAtari6502BaseGame
+        );
+
+        // Sampled ROM verify - 2^n samples of every ROM / then a CRC of those that pass
+        static PERROR romSample(
+                                void *cAtari6502BaseGame
+        );
+
+        static PERROR romQuick(
+                               void *cAtari6502BaseGame
+        );
+
+        // Binary dump of every ROM over serial - see CRomDump.h
+        static PERROR romDump(
+                              void *cAtari6502BaseGame
+        );
+
+        // Compare a ROM with an image sent over serial - see CRomCompare.h
+        static PERROR romCompare(
+                                 void *cAtari6502BaseGame
+        );
+
+        // Print a table of the ROMs on a good board over serial - see CRomLearn.h
+        static PERROR romLearn(
+                               void *cAtari6502BaseGame
+        );
+
+        // The same for a board with no table, its layout sent over serial
+        static PERROR romLearnLayout(
+                                     void *cAtari6502BaseGame
+        );
+
+        // CRC with the self-test XOR and sum of the next ROM each time
+        static PERROR romChecksum(
+                                  void *cAtari6502BaseGame
+        );
+
+        //Bit masks - used to test inputs etc by masking / selecting specific bits of data
+        static const UINT32 s_MSK_D0 = 0x01;
+        static const UINT32 s_MSK_D1 = 0x02;
+        static const UINT32 s_MSK_D2 = 0x04;
+        static const UINT32 s_MSK_D3 = 0x08;
+        static const UINT32 s_MSK_D4 = 0x10;
+        static const UINT32 s_MSK_D5 = 0x20;
+        static const UINT32 s_MSK_D6 = 0x40;
+        static const UINT32 s_MSK_D7 = 0x80;
+
+        static const UINT32 s_MSK_D0_TO_D3 = 0x0F;
+        static const UINT32 s_MSK_D2_TO_D5 = 0x3C;
+        static const UINT32 s_MSK_D6_D7 = 0xC0;
+        static const UINT32 s_MSK_TRAK = 0x8F; // bits 0-3 and 7
+
+        static const UINT32 s_MSK_ALL = 0xFF;
+
+        static const UINT32 s_ACT_Hi = 0x00; //Active High
+        static const UINT32 s_ACT_Lo = 0x01; //Active Low
+
+    protected:
+
+        CAtari6502BaseGame(
+            const ROM_REGION    *romRegion,
+            const ROM_SET       *romSet,
+            const RAM_REGION    *ramRegion,
+            const RAM_REGION    *ramRegionByteOnly,
+            const RAM_REGION    *ramRegionWriteOnly,
+            const INPUT_REGION  *inputRegion,
+            const OUTPUT_REGION *outputRegion,
+            const CUSTOM_FUNCTION *customFunction
+        );
+
+        CAtari6502BaseGame(
+            const ROM_DATA2N    *romData2n,
+            const ROM_REGION    *romRegion,
+            const RAM_REGION    *ramRegion,
+            const RAM_REGION    *ramRegionByteOnly,
+            const RAM_REGION    *ramRegionWriteOnly,
+            const INPUT_REGION  *inputRegion,
+            const OUTPUT_REGION *outputRegion,
+            const CUSTOM_FUNCTION *customFunction
+        );
+
+        ~CAtari6502BaseGame(
+        );
+
+        void earomCreate(
+            UINT16 writeBaseAddress,
+            UINT16 controlAddress,
+            UINT16 readAddress,
+            UINT8  C1C2mapping,
+            UINT16 confirmAddress,
+            UINT8  confirmMask,
+            bool   confirmActiveLow
+        );
+
+    private:
+
+        void cpuCreate(
+        );
+
+        PERROR confirmDestructive(
+        );
+
+        CER2055       *m_earom;
+        UINT16        m_confirmAddress;
+        UINT8         m_confirmMask;
+        bool          m_confirmActiveLow;
+        const ROM_SET *m_romSet;
+        UINT8         m_checksumRom;
+
+};
+
+#endif
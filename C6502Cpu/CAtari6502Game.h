@@ -0,0 +1,222 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef CAtari6502Game_h
+#define CAtari6502Game_h
+
+#include "CAtari6502BaseGame.h"
+
+//
+// Board descriptor - the wiring of an Atari 6502 board that the tests depend on.
+// A board derives from this and replaces only what differs, e.g.
+//
+//   class CAsteroidsBoard : public CAtari6502Board
+//   {
+//       public:
+//           static const ICpu::Interrupt c_interrupt = ICpu::NMI;
+//           static const UINT8 c_interruptLoops = 10;
+//   };
+//
+// The constants are folded into CAtari6502Game<BOARD> when it's built, so the
+// interrupt loop of each board has no tests for the wiring of the others.
+//
+class CAtari6502Board
+{
+    public:
+
+        //
+        // Interrupt check - the line, how many periods to check and the wait in ms for
+        // the line to go active and inactive. No loops uses the CGame check.
+        //
+        static const ICpu::Interrupt c_interrupt = ICpu::IRQ0;
+        static const UINT8  c_interruptLoops = 0;
+        static const UINT16 c_interruptActiveMs = 10;
+        static const UINT16 c_interruptInactiveMs = 10;
+
+        //
+        // Address written to clear the interrupt once it's seen active.
+        // 0 - the interrupt clears itself.
+        //
+        static const UINT16 c_interruptResetAddress = 0;
+
+        //
+        // Self-test switch that stops the interrupt source when ON (closed = low).
+        // No mask - no switch.
+        //
+        static const UINT16 c_testSwitchAddress = 0;
+        static const UINT8  c_testSwitchMask = 0;
+
+        //
+        // ER2055 EAROM - see CER2055.h. No read address - no EAROM.
+        // The confirm switch (usually P1 START) is held down for the destructive tests.
+        //
+        static const UINT16 c_earomWriteAddress = 0;
+        static const UINT16 c_earomControlAddress = 0;
+        static const UINT16 c_earomReadAddress = 0;
+        static const UINT8  c_earomMapping = EAROM_C1D1_C2D2;
+        static const UINT16 c_earomConfirmAddress = 0;
+        static const UINT8  c_earomConfirmMask = 0;
+        static const bool   c_earomConfirmActiveLow = true;
+};
+
+template <class BOARD>
+class CAtari6502Game : public CAtari6502BaseGame
+{
+    public:
+
+        virtual PERROR interruptCheck(
+        );
+
+    protected:
+
+        CAtari6502Game(
+            const ROM_REGION    *romRegion,
+            const ROM_SET       *romSet,
+            const RAM_REGION    *ramRegion,
+            const RAM_REGION    *ramRegionByteOnly,
+            const RAM_REGION    *ramRegionWriteOnly,
+            const INPUT_REGION  *inputRegion,
+            const OUTPUT_REGION *outputRegion,
+            const CUSTOM_FUNCTION *customFunction
+        ) : CAtari6502BaseGame( romRegion,
+                                romSet,
+                                ramRegion,
+                                ramRegionByteOnly,
+                                ramRegionWriteOnly,
+                                inputRegion,
+                                outputRegion,
+                                customFunction )
+        {
+            boardCreate();
+        }
+
+        CAtari6502Game(
+            const ROM_DATA2N    *romData2n,
+            const ROM_REGION    *romRegion,
+            const RAM_REGION    *ramRegion,
+            const RAM_REGION    *ramRegionByteOnly,
+            const RAM_REGION    *ramRegionWriteOnly,
+            const INPUT_REGION  *inputRegion,
+            const OUTPUT_REGION *outputRegion,
+            const CUSTOM_FUNCTION *customFunction
+        ) : CAtari6502BaseGame( romData2n,
+                                romRegion,
+                                ramRegion,
+                                ramRegionByteOnly,
+                                ramRegionWriteOnly,
+                                inputRegion,
+                                outputRegion,
+                                customFunction )
+        {
+            boardCreate();
+        }
+
+    private:
+
+        void boardCreate(
+        );
+
+};
+
+template <class BOARD>
+void
+CAtari6502Game<BOARD>::boardCreate(
+)
+{
+    m_interrupt = BOARD::c_interrupt;
+
+    if (BOARD::c_earomReadAddress != 0)
+    {
+        earomCreate(BOARD::c_earomWriteAddress,
+                    BOARD::c_earomControlAddress,
+                    BOARD::c_earomReadAddress,
+                    BOARD::c_earomMapping,
+                    BOARD::c_earomConfirmAddress,
+                    BOARD::c_earomConfirmMask,
+                    BOARD::c_earomConfirmActiveLow);
+    }
+}
+
+//
+// Interrupt Test
+//
+// Checks the interrupt goes active and inactive on its own for a few periods,
+// clearing it at the board's reset address if it has one.
+//
+template <class BOARD>
+PERROR
+CAtari6502Game<BOARD>::interruptCheck(
+)
+{
+    PERROR error = errorSuccess;
+
+    if (BOARD::c_interruptLoops == 0)
+    {
+        return CGame::interruptCheck();
+    }
+
+    if (BOARD::c_testSwitchMask != 0)
+    {
+        UINT16 data16 = 0x0000;
+
+        // Only run test if the self-test switch is OFF
+        error = m_cpu->memoryRead(BOARD::c_testSwitchAddress, &data16);
+        if (!(data16 & BOARD::c_testSwitchMask))
+        {
+            error = errorCustom;
+            error->code = ERROR_SUCCESS;
+            error->description = "N/A w/test sw ON";
+
+            return error;
+        }
+    }
+
+    // repeat test a few times
+    for (UINT8 i = 0 ; i < BOARD::c_interruptLoops ; i++)
+    {
+        // Wait for the interrupt to be active
+        error = m_cpu->waitForInterrupt(BOARD::c_interrupt, true, BOARD::c_interruptActiveMs);
+
+        if (SUCCESS(error) && (BOARD::c_interruptResetAddress != 0))
+        {
+            // clear the interrupt
+            error = m_cpu->memoryWrite(BOARD::c_interruptResetAddress, 0x00);
+        }
+
+        if (SUCCESS(error))
+        {
+            // Wait for the interrupt to be inactive
+            error = m_cpu->waitForInterrupt(BOARD::c_interrupt, false, BOARD::c_interruptInactiveMs);
+        }
+
+        if (FAILED(error))
+        {
+            break;
+        }
+    }
+
+    return error;
+}
+
+#endif
@@ -23,8 +23,6 @@
 // EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //
 #include "CAtariAVGBaseGame.h"
-#include "C6502Cpu.h"
-#include "C6502ClockMasterCpu.h"
 #include <DFR_Key.h>
 #include "CRomCheck.h"
 
@@ -78,85 +76,23 @@ static const RAM_REGION s_ramRegionWriteOnly[] PROGMEM = { {0} }; // end of list
 // Custom functions
 //
 static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = {
+    //                                        "0123456789"
+    {CAtariAVGBaseGame::romChecksum,          "ROM Cksum "},
     {NO_CUSTOM_FUNCTION} // end of list
 };
 
 
 CAtariAVGBaseGame::CAtariAVGBaseGame(
-    const bool          clockMaster,
     const ROM_REGION    *romRegion,
     const INPUT_REGION  *inputRegion,
     const OUTPUT_REGION *outputRegion
-) : CGame( romRegion,
-           s_ramRegion,
-           s_ramRegionByteOnly,
-           s_ramRegionWriteOnly,
-           inputRegion,
-           outputRegion,
-           s_customFunction )
+) : CAtari6502Game( romRegion,
+                    (const ROM_SET *) NULL,
+                    s_ramRegion,
+                    s_ramRegionByteOnly,
+                    s_ramRegionWriteOnly,
+                    inputRegion,
+                    outputRegion,
+                    s_customFunction )
 {
-    if (clockMaster)
-    {
-        m_cpu = new C6502ClockMasterCpu(false);
-    }
-    else
-    {
-        m_cpu = new C6502Cpu(false);
-    }
-
-    m_cpu->idle();
-
-    // IRQ is not connected on this game
-    // NMI is connected to a 250 Hz timer, which is disabled when the game's self-test switch is closed
-    m_interrupt = ICpu::NMI;
-    m_interruptAutoVector = true;
-}
-
-
-CAtariAVGBaseGame::~CAtariAVGBaseGame(
-)
-{
-    delete m_cpu;
-    m_cpu = (ICpu *) NULL;
-}
-
-//
-// Custom interrupt test
-//
-PERROR
-CAtariAVGBaseGame::interruptCheck(
-)
-{
-    PERROR error = errorSuccess;
-    UINT16 data16 = 0x0000;
-    
-    // Only run test if the self-test switch is OFF
-    error = m_cpu->memoryRead(0x0800, &data16);
-    if (data16 & s_MSK_D4)
-    {
-        // NMI is connected to a 250 Hz timer,
-        // so we just verify that the state is toggling on its own
-        for (int i = 0 ; i < 10 ; i++)
-        {
-            // Wait up to 100ms for interrupt to be active
-            error = m_cpu->waitForInterrupt(m_interrupt, true, 100);
-            if (SUCCESS(error))
-            {
-                // Wait for interrupt to be inactive
-                error = m_cpu->waitForInterrupt(m_interrupt, false, 100);
-            }
-            if (FAILED(error))
-            {
-                break;
-            }
-        }
-    }
-    else
-    {
-        error = errorCustom;
-        error->code = ERROR_SUCCESS;
-        error->description = "N/A w/test sw ON";
-    }
-
-    return error;
 }
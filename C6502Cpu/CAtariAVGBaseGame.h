@@ -25,53 +25,35 @@
 #ifndef CAtariAVGBaseGame_h
 #define CAtariAVGBaseGame_h
 
-#include "CGame.h"
+#include "CAtari6502Game.h"
 
-class CAtariAVGBaseGame : public CGame
+//
+// IRQ is not connected. NMI is a 250 Hz timer that stops while the self-test
+// switch (0x0800 D4, low when ON) is closed.
+//
+class CAtariAVGBoard : public CAtari6502Board
 {
     public:
-    
-    //Bit masks - used to test inputs etc by masking / selecting specific bits of data
-    static const UINT32 s_MSK_D0 = 0x01;
-    static const UINT32 s_MSK_D1 = 0x02;
-    static const UINT32 s_MSK_D2 = 0x04;
-    static const UINT32 s_MSK_D3 = 0x08;
-    static const UINT32 s_MSK_D4 = 0x10;
-    static const UINT32 s_MSK_D5 = 0x20;
-    static const UINT32 s_MSK_D6 = 0x40;
-    static const UINT32 s_MSK_D7 = 0x80;
-    
-    static const UINT32 s_MSK_D0_TO_D3 = 0x0F;
-    static const UINT32 s_MSK_D2_TO_D5 = 0x3C;
-    static const UINT32 s_MSK_D6_D7 = 0xC0;
-    
-    static const UINT32 s_MSK_ALL = 0xFF;
-    
-    //Active High and Active Low
-    static const UINT32 s_ACT_Hi = 0x00;
-    static const UINT32 s_ACT_Lo = 0x01;
 
-    //
-    // Custom interrupt test (no IRQ; timer on NMI)
-    //
-    virtual PERROR interruptCheck(
-    );
+        static const ICpu::Interrupt c_interrupt = ICpu::NMI;
+        static const UINT8  c_interruptLoops = 10;
+        static const UINT16 c_interruptActiveMs = 100;
+        static const UINT16 c_interruptInactiveMs = 100;
+
+        static const UINT16 c_testSwitchAddress = 0x0800;
+        static const UINT8  c_testSwitchMask = CAtari6502BaseGame::s_MSK_D4;
+};
 
+class CAtariAVGBaseGame : public CAtari6502Game<CAtariAVGBoard>
+{
     protected:
 
         CAtariAVGBaseGame(
-            const bool          clockMaster,
             const ROM_REGION    *romRegion,
             const INPUT_REGION  *inputRegion,
             const OUTPUT_REGION *outputRegion
         );
 
-        ~CAtariAVGBaseGame(
-        );
-
-    
-    private:
-
 };
 
 #endif
@@ -135,35 +135,19 @@ IGame*
 CBattlezoneGame::createInstanceSet2(
 )
 {
-    return (new CBattlezoneGame(false, s_romRegionSet2));
-}
-
-IGame*
-CBattlezoneGame::createInstanceClockMasterSet2(
-)
-{
-    return (new CBattlezoneGame(true, s_romRegionSet2));
+    return (new CBattlezoneGame(s_romRegionSet2));
 }
 
 IGame*
 CBattlezoneGame::createInstanceSet1(
 )
 {
-    return (new CBattlezoneGame(false, s_romRegionSet1));
-}
-
-IGame*
-CBattlezoneGame::createInstanceClockMasterSet1(
-)
-{
-    return (new CBattlezoneGame(true, s_romRegionSet1));
+    return (new CBattlezoneGame(s_romRegionSet1));
 }
 
 CBattlezoneGame::CBattlezoneGame(
-   const bool       clockMaster,
    const ROM_REGION *romRegion
-   ) : CAtariAVGBaseGame( clockMaster,
-                          romRegion,
+   ) : CAtariAVGBaseGame( romRegion,
                           s_inputRegion,
                           s_outputRegion
                          )
@@ -38,9 +38,7 @@ class CBattlezoneGame : public CAtariAVGBaseGame
         // Constructors for this game.
         //
         static IGame* createInstanceSet2();
-        static IGame* createInstanceClockMasterSet2();
         static IGame* createInstanceSet1();
-        static IGame* createInstanceClockMasterSet1();
 
         //
         // IGame Interface - wholly implemented in the Base game.
@@ -52,7 +50,6 @@ class CBattlezoneGame : public CAtariAVGBaseGame
         // Different ROM sets supplied.
         //
         CBattlezoneGame(
-            const bool       clockMaster,
             const ROM_REGION *romRegion
         );
 
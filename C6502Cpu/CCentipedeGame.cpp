@@ -79,14 +79,8 @@ static const UINT32 s_ROM_ADDR_J1  = 0x3800;
 //   not addressable by the CPU
 
 //
-// hardware addresses
+// hardware addresses - the IRQ reset and EAROM are in CCentipedeBoard
 //
-static const UINT32 s_IRQ_RESET_ADDR = 0x1800;
-static const UINT32 s_EAROM_WRITE_ADDR = 0x1600;
-static const UINT32 s_EAROM_CONTROL_ADDR = 0x1680;
-static const UINT32 s_EAROM_READ_ADDR = 0x1700;
-static const UINT32 s_P1START_ADDRESS = 0x0c01;  // address for P1START to confirm destructive EAROM operations
-static const UINT32 s_P1START_MASK = CCentipedeBaseGame::s_MSK_D0; // bitmask for P1START
 
 //
 // ROM regions
@@ -123,6 +117,16 @@ static const ROM_REGION s_romRegionSet4[] PROGMEM = {
     {NO_BANK_SWITCH, s_ROM_ADDR_J1,  s_ROM_2716_SIZE, s_romData_4_J1,  0x33ce4640, "J1 "},
     {0} }; // end of list
 
+//
+// All the sets above - used to identify the installed set from the 2^n data samples
+//
+static const ROM_SET s_romSet[] PROGMEM = { //"0123456789"
+    {s_romRegionSet4,  "Centiped 4"},
+    {s_romRegionSet3,  "Centiped 3"},
+    {s_romRegionSet2,  "Centiped 2"},
+    {s_romRegionSet1,  "Centiped 1"},
+    {0} }; // end of list
+
 //
 // RAM regions
 //
@@ -175,26 +179,26 @@ static const RAM_REGION s_ramRegionWriteOnly[] PROGMEM = {
 //
 static const INPUT_REGION s_inputRegion[] PROGMEM = {
     //                                                        "012", "012345"
-    {NO_BANK_SWITCH, 0x0800,  CCentipedeBaseGame::s_MSK_ALL,  "M89", "OPTSW1"}, // option switch block 1, M8/M9 (8 bits)
-    {NO_BANK_SWITCH, 0x0801,  CCentipedeBaseGame::s_MSK_ALL,  "M89", "OPTSW2"}, // option switch block 2, M8/M9 (8 bits)
-
-    {NO_BANK_SWITCH, 0x0c01,  CCentipedeBaseGame::s_MSK_D7,   "K9 ", "COIN R"}, // K9 pin 10, bit 7
-    {NO_BANK_SWITCH, 0x0c01,  CCentipedeBaseGame::s_MSK_D6,   "K9 ", "COIN C"}, // K9 pin 6,  bit 6
-    {NO_BANK_SWITCH, 0x0c01,  CCentipedeBaseGame::s_MSK_D5,   "K9 ", "COIN L"}, // K9 pin 13, bit 5
-    {NO_BANK_SWITCH, 0x0c01,  CCentipedeBaseGame::s_MSK_D4,   "K9 ", "SLAM "},  // K9 pin 3,  bit 4
-    {NO_BANK_SWITCH, 0x0c01,  CCentipedeBaseGame::s_MSK_D3,   "L9 ", "FIRE2 "}, // L9 pin 10, bit 3
-    {NO_BANK_SWITCH, 0x0c01,  CCentipedeBaseGame::s_MSK_D2,   "L9 ", "FIRE1 "}, // L9 pin 6,  bit 2
-    {NO_BANK_SWITCH, 0x0c01,  CCentipedeBaseGame::s_MSK_D1,   "L9 ", "START2"}, // L9 pin 13, bit 1
-    {NO_BANK_SWITCH, 0x0c01,  CCentipedeBaseGame::s_MSK_D0,   "L9 ", "START1"}, // L9 pin 3,  bit 0
-
-    {NO_BANK_SWITCH, 0x0c00,  CCentipedeBaseGame::s_MSK_TRAK, "L9 ", "TRAK-H"}, // Trak ball horizontal count and direction (L9 bits 0-3 and K9 bit 7)
-    {NO_BANK_SWITCH, 0x0c02,  CCentipedeBaseGame::s_MSK_TRAK, "D9 ", "TRAK-V"}, // Trak ball vertical count and direction (D9 bits 0-3 and DE10 bit 7)
-
-    {NO_BANK_SWITCH, 0x0c03,  CCentipedeBaseGame::s_MSK_ALL,  "D9 ", "JYSTKS"}, // read D9 bits 0-3 and DE10 bits 4-7 as joystick inputs
-
-    {NO_BANK_SWITCH, 0x0c00,  CCentipedeBaseGame::s_MSK_D6,   "K9 ", "VBlank"}, // Vertical blank, K9 pin 5, bit 6
-    {NO_BANK_SWITCH, 0x0c00,  CCentipedeBaseGame::s_MSK_D5,   "K9 ", "SlfTst"}, // Self-test switch, K9 pin 14, bit 5
-    {NO_BANK_SWITCH, 0x0c00,  CCentipedeBaseGame::s_MSK_D4,   "K9 ", "CkTail"}, // Cocktail cabinet harness, K9 pin 2, bit 4
+    {NO_BANK_SWITCH, 0x0800,  CAtari6502BaseGame::s_MSK_ALL,  "M89", "OPTSW1"}, // option switch block 1, M8/M9 (8 bits)
+    {NO_BANK_SWITCH, 0x0801,  CAtari6502BaseGame::s_MSK_ALL,  "M89", "OPTSW2"}, // option switch block 2, M8/M9 (8 bits)
+
+    {NO_BANK_SWITCH, 0x0c01,  CAtari6502BaseGame::s_MSK_D7,   "K9 ", "COIN R"}, // K9 pin 10, bit 7
+    {NO_BANK_SWITCH, 0x0c01,  CAtari6502BaseGame::s_MSK_D6,   "K9 ", "COIN C"}, // K9 pin 6,  bit 6
+    {NO_BANK_SWITCH, 0x0c01,  CAtari6502BaseGame::s_MSK_D5,   "K9 ", "COIN L"}, // K9 pin 13, bit 5
+    {NO_BANK_SWITCH, 0x0c01,  CAtari6502BaseGame::s_MSK_D4,   "K9 ", "SLAM "},  // K9 pin 3,  bit 4
+    {NO_BANK_SWITCH, 0x0c01,  CAtari6502BaseGame::s_MSK_D3,   "L9 ", "FIRE2 "}, // L9 pin 10, bit 3
+    {NO_BANK_SWITCH, 0x0c01,  CAtari6502BaseGame::s_MSK_D2,   "L9 ", "FIRE1 "}, // L9 pin 6,  bit 2
+    {NO_BANK_SWITCH, 0x0c01,  CAtari6502BaseGame::s_MSK_D1,   "L9 ", "START2"}, // L9 pin 13, bit 1
+    {NO_BANK_SWITCH, 0x0c01,  CAtari6502BaseGame::s_MSK_D0,   "L9 ", "START1"}, // L9 pin 3,  bit 0
+
+    {NO_BANK_SWITCH, 0x0c00,  CAtari6502BaseGame::s_MSK_TRAK, "L9 ", "TRAK-H"}, // Trak ball horizontal count and direction (L9 bits 0-3 and K9 bit 7)
+    {NO_BANK_SWITCH, 0x0c02,  CAtari6502BaseGame::s_MSK_TRAK, "D9 ", "TRAK-V"}, // Trak ball vertical count and direction (D9 bits 0-3 and DE10 bit 7)
+
+    {NO_BANK_SWITCH, 0x0c03,  CAtari6502BaseGame::s_MSK_ALL,  "D9 ", "JYSTKS"}, // read D9 bits 0-3 and DE10 bits 4-7 as joystick inputs
+
+    {NO_BANK_SWITCH, 0x0c00,  CAtari6502BaseGame::s_MSK_D6,   "K9 ", "VBlank"}, // Vertical blank, K9 pin 5, bit 6
+    {NO_BANK_SWITCH, 0x0c00,  CAtari6502BaseGame::s_MSK_D5,   "K9 ", "SlfTst"}, // Self-test switch, K9 pin 14, bit 5
+    {NO_BANK_SWITCH, 0x0c00,  CAtari6502BaseGame::s_MSK_D4,   "K9 ", "CkTail"}, // Cocktail cabinet harness, K9 pin 2, bit 4
     {0} // end of list
 };
 
@@ -202,18 +206,18 @@ static const INPUT_REGION s_inputRegion[] PROGMEM = {
 // Hardware Outputs
 //
 static const OUTPUT_REGION s_outputRegion[] PROGMEM = { //                                 "012", "012345"
-    {NO_BANK_SWITCH, 0x1c00, CCentipedeBaseGame::s_MSK_D7,  CCentipedeBaseGame::s_ACT_Hi,  "M10", "CNCTLT"}, // M10 pin 4,  LEFT Coin counter
-    {NO_BANK_SWITCH, 0x1c01, CCentipedeBaseGame::s_MSK_D7,  CCentipedeBaseGame::s_ACT_Hi,  "M10", "CNCTCT"}, // M10 pin 5,  CENTER Coin counter
-    {NO_BANK_SWITCH, 0x1c02, CCentipedeBaseGame::s_MSK_D7,  CCentipedeBaseGame::s_ACT_Hi,  "M10", "CNCTRT"}, // M10 pin 6,  RIGHT Coin counter
-    {NO_BANK_SWITCH, 0x1c03, CCentipedeBaseGame::s_MSK_D7,  CCentipedeBaseGame::s_ACT_Lo,  "M10", "P1 LED"}, // M10 pin 7,  Player 1 start LED
-    {NO_BANK_SWITCH, 0x1c04, CCentipedeBaseGame::s_MSK_D7,  CCentipedeBaseGame::s_ACT_Lo,  "M10", "P2 LED"}, // M10 pin 9,  Player 2 start LED
-    // {NO_BANK_SWITCH, 0x1c05, CCentipedeBaseGame::s_MSK_D7,  CCentipedeBaseGame::s_ACT_Lo,  "M10", "LED 3 "}, // M10 pin 10, LED 3 (unused)
-    // {NO_BANK_SWITCH, 0x1c06, CCentipedeBaseGame::s_MSK_D7,  CCentipedeBaseGame::s_ACT_Lo,  "M10", "LED 4 "}, // M10 pin 11, LED 4 (unused)
-    {NO_BANK_SWITCH, 0x1c07, CCentipedeBaseGame::s_MSK_D7,  CCentipedeBaseGame::s_ACT_Lo,  "M10", "TrkFlp"}, // M10 pin 12, Trak ball flip control
-
-    {NO_BANK_SWITCH, 0x1800, CCentipedeBaseGame::s_MSK_ALL, CCentipedeBaseGame::s_ACT_Lo,  "F3 ", "IRQAck"}, // F3 pin 11, IRQ Acknowledge
-    {NO_BANK_SWITCH, 0x2000, CCentipedeBaseGame::s_MSK_ALL, CCentipedeBaseGame::s_ACT_Lo,  "F3 ", "WD Rst"}, // F3 pin 3,  Clear watchdog timer
-    {NO_BANK_SWITCH, 0x2400, CCentipedeBaseGame::s_MSK_ALL, CCentipedeBaseGame::s_ACT_Lo,  "F3 ", "TrkClr"}, // F3 pin 6,  Clear trakball counters
+    {NO_BANK_SWITCH, 0x1c00, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Hi,  "M10", "CNCTLT"}, // M10 pin 4,  LEFT Coin counter
+    {NO_BANK_SWITCH, 0x1c01, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Hi,  "M10", "CNCTCT"}, // M10 pin 5,  CENTER Coin counter
+    {NO_BANK_SWITCH, 0x1c02, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Hi,  "M10", "CNCTRT"}, // M10 pin 6,  RIGHT Coin counter
+    {NO_BANK_SWITCH, 0x1c03, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Lo,  "M10", "P1 LED"}, // M10 pin 7,  Player 1 start LED
+    {NO_BANK_SWITCH, 0x1c04, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Lo,  "M10", "P2 LED"}, // M10 pin 9,  Player 2 start LED
+    // {NO_BANK_SWITCH, 0x1c05, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Lo,  "M10", "LED 3 "}, // M10 pin 10, LED 3 (unused)
+    // {NO_BANK_SWITCH, 0x1c06, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Lo,  "M10", "LED 4 "}, // M10 pin 11, LED 4 (unused)
+    {NO_BANK_SWITCH, 0x1c07, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Lo,  "M10", "TrkFlp"}, // M10 pin 12, Trak ball flip control
+
+    {NO_BANK_SWITCH, 0x1800, CAtari6502BaseGame::s_MSK_ALL, CAtari6502BaseGame::s_ACT_Lo,  "F3 ", "IRQAck"}, // F3 pin 11, IRQ Acknowledge
+    {NO_BANK_SWITCH, 0x2000, CAtari6502BaseGame::s_MSK_ALL, CAtari6502BaseGame::s_ACT_Lo,  "F3 ", "WD Rst"}, // F3 pin 3,  Clear watchdog timer
+    {NO_BANK_SWITCH, 0x2400, CAtari6502BaseGame::s_MSK_ALL, CAtari6502BaseGame::s_ACT_Lo,  "F3 ", "TrkClr"}, // F3 pin 6,  Clear trakball counters
     {0} // end of list
 };
 
@@ -222,11 +226,22 @@ static const OUTPUT_REGION s_outputRegion[] PROGMEM = { //
 //
 static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = {
     //                                    "0123456789"
-//    {CCentipedeBaseGame::earomIdle,       "EAROM Idle"},
-    {CCentipedeBaseGame::earomReadTest,   "EAROM Read"},
-    {CCentipedeBaseGame::earomSerialDump, "EAROM Dump"},
-    {CCentipedeBaseGame::earomSerialLoad, "EAROM Load"},
-    {CCentipedeBaseGame::earomErase,      "EAROM Wipe"},
+//    {CAtari6502BaseGame::earomIdle,       "EAROM Idle"},
+    {CAtari6502BaseGame::earomReadTest,   "EAROM Read"},
+    {CAtari6502BaseGame::earomSerialDump, "EAROM Dump"},
+    {CAtari6502BaseGame::earomSerialLoad, "EAROM Load"},
+    {CAtari6502BaseGame::earomErase,      "EAROM Wipe"},
+    {CAtari6502BaseGame::romIdentify,     "ROM Ident "},
+    {CAtari6502BaseGame::romVerify,       "ROM BlkMap"},
+    {CAtari6502BaseGame::romVerifyFirstBlock, "ROM Blk1st"},
+    {CAtari6502BaseGame::romSample,           "ROM Sample"},
+    {CAtari6502BaseGame::romQuick,            "ROM Quick "},
+    {CAtari6502BaseGame::romDump,             "ROM Dump  "},
+    {CAtari6502BaseGame::romCompare,          "ROM Comp  "},
+    {CAtari6502BaseGame::romLearn,            "ROM Learn "},
+    {CAtari6502BaseGame::romLearnLayout,      "ROM Layout"},
+    {CAtari6502BaseGame::romChecksum,         "ROM Cksum "},
+    {CCrc32::benchmark,                   "CRC Bench "},
     {NO_CUSTOM_FUNCTION} // end of list
 };
 
@@ -235,75 +250,40 @@ IGame*
 CCentipedeGame::createInstanceSet1(
 )
 {
-    return (new CCentipedeGame(false, s_romRegionSet1));
-}
-
-IGame*
-CCentipedeGame::createInstanceClockMasterSet1(
-)
-{
-    return (new CCentipedeGame(true, s_romRegionSet1));
+    return (new CCentipedeGame(s_romRegionSet1));
 }
 
 IGame*
 CCentipedeGame::createInstanceSet2(
 )
 {
-    return (new CCentipedeGame(false, s_romRegionSet2));
-}
-
-IGame*
-CCentipedeGame::createInstanceClockMasterSet2(
-)
-{
-    return (new CCentipedeGame(true, s_romRegionSet2));
+    return (new CCentipedeGame(s_romRegionSet2));
 }
 
 IGame*
 CCentipedeGame::createInstanceSet3(
 )
 {
-    return (new CCentipedeGame(false, s_romRegionSet3));
-}
-
-IGame*
-CCentipedeGame::createInstanceClockMasterSet3(
-)
-{
-    return (new CCentipedeGame(true, s_romRegionSet3));
+    return (new CCentipedeGame(s_romRegionSet3));
 }
 
 IGame*
 CCentipedeGame::createInstanceSet4(
 )
 {
-    return (new CCentipedeGame(false, s_romRegionSet4));
-}
-
-IGame*
-CCentipedeGame::createInstanceClockMasterSet4(
-)
-{
-    return (new CCentipedeGame(true, s_romRegionSet4));
+    return (new CCentipedeGame(s_romRegionSet4));
 }
 
 CCentipedeGame::CCentipedeGame(
-               const bool       clockMaster,
                const ROM_REGION *romRegion
-               ) : CCentipedeBaseGame( clockMaster,
-                                       romRegion,
-                                       s_ramRegion,
-                                       s_ramRegionByteOnly,
-                                       s_ramRegionWriteOnly,
-                                       s_inputRegion,
-                                       s_outputRegion,
-                                       s_customFunction,
-                                       s_IRQ_RESET_ADDR,
-                                       s_EAROM_WRITE_ADDR,
-                                       s_EAROM_CONTROL_ADDR,
-                                       s_EAROM_READ_ADDR,
-                                       s_P1START_ADDRESS,
-                                       s_P1START_MASK
-                                      )
+               ) : CAtari6502Game( romRegion,
+                                   s_romSet,
+                                   s_ramRegion,
+                                   s_ramRegionByteOnly,
+                                   s_ramRegionWriteOnly,
+                                   s_inputRegion,
+                                   s_outputRegion,
+                                   s_customFunction
+                                  )
 {
 }
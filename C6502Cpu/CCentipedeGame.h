@@ -26,9 +26,31 @@
 #ifndef CCentipedeGame_h
 #define CCentipedeGame_h
 
-#include "CCentipedeBaseGame.h"
+#include "CAtari6502Game.h"
 
-class CCentipedeGame : public CCentipedeBaseGame
+//
+// IRQ fires every 32 scanlines (about 2 ms) and is cleared by a write to IRQRES.
+// P1 START is active low.
+//
+class CCentipedeBoard : public CAtari6502Board
+{
+    public:
+
+        static const ICpu::Interrupt c_interrupt = ICpu::IRQ0;
+        static const UINT8  c_interruptLoops = 10;
+        static const UINT16 c_interruptInactiveMs = 1;
+        static const UINT16 c_interruptResetAddress = 0x1800;
+
+        static const UINT16 c_earomWriteAddress = 0x1600;
+        static const UINT16 c_earomControlAddress = 0x1680;
+        static const UINT16 c_earomReadAddress = 0x1700;
+        static const UINT8  c_earomMapping = EAROM_C1D1_C2D2;
+        static const UINT16 c_earomConfirmAddress = 0x0c01;
+        static const UINT8  c_earomConfirmMask = CAtari6502BaseGame::s_MSK_D0;
+        static const bool   c_earomConfirmActiveLow = true;
+};
+
+class CCentipedeGame : public CAtari6502Game<CCentipedeBoard>
 {
 public:
     
@@ -36,13 +58,9 @@ public:
     // Constructors for this game.
     //
     static IGame* createInstanceSet4();
-    static IGame* createInstanceClockMasterSet4();
     static IGame* createInstanceSet3();
-    static IGame* createInstanceClockMasterSet3();
     static IGame* createInstanceSet2();
-    static IGame* createInstanceClockMasterSet2();
     static IGame* createInstanceSet1();
-    static IGame* createInstanceClockMasterSet1();
 
     static PERROR videoTest(
                             void *cCentipedeGame
@@ -54,7 +72,6 @@ private:
     // Different ROM sets supplied.
     //
     CCentipedeGame(
-                    const bool       clockMaster,
                     const ROM_REGION *romRegion
                     );
 
@@ -23,8 +23,6 @@
 // EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //
 #include "CLunarLanderBaseGame.h"
-#include "C6502Cpu.h"
-#include "C6502ClockMasterCpu.h"
 #include <DFR_Key.h>
 #include "CRomCheck.h"
 #include "CLunarLanderGame.h"
@@ -79,44 +77,21 @@ static const RAM_REGION s_ramRegionWriteOnly[] PROGMEM = { {0} }; // end of list
 //
 static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = {
     //                                         "0123456789"
+    {CLunarLanderBaseGame::romChecksum,        "ROM Cksum "},
     {NO_CUSTOM_FUNCTION}
 }; // end of list
 
 CLunarLanderBaseGame::CLunarLanderBaseGame(
-    const bool          clockMaster,
     const ROM_REGION    *romRegion,
     const INPUT_REGION  *inputRegion,
     const OUTPUT_REGION *outputRegion
-) : CGame( romRegion,
-           s_ramRegion,
-           s_ramRegionByteOnly,
-           s_ramRegionWriteOnly,
-           inputRegion,
-           outputRegion,
-           s_customFunction )
+) : CAtari6502Game( romRegion,
+                    (const ROM_SET *) NULL,
+                    s_ramRegion,
+                    s_ramRegionByteOnly,
+                    s_ramRegionWriteOnly,
+                    inputRegion,
+                    outputRegion,
+                    s_customFunction )
 {
-    if (clockMaster)
-    {
-        m_cpu = new C6502ClockMasterCpu(false);
-    }
-    else
-    {
-        m_cpu = new C6502Cpu(false);
-    }
-
-    m_cpu->idle();
-
-    // VBLANK is on the INT pin (==IRQ0).
-    m_interrupt = ICpu::IRQ0;
-
-    // The interrupt is based on an internal vector
-    m_interruptAutoVector = true;
-}
-
-
-CLunarLanderBaseGame::~CLunarLanderBaseGame(
-)
-{
-    delete m_cpu;
-    m_cpu = (ICpu *) NULL;
 }
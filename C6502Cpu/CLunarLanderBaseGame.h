@@ -25,48 +25,28 @@
 #ifndef CLunarLanderBaseGame_h
 #define CLunarLanderBaseGame_h
 
-#include "CGame.h"
+#include "CAtari6502Game.h"
 
-
-class CLunarLanderBaseGame : public CGame
+//
+// VBLANK is on the INT pin (==IRQ0) and is left to the CGame interrupt check.
+//
+class CLunarLanderBoard : public CAtari6502Board
 {
     public:
-    
-    //Bit masks - used to test inputs etc by masking / selecting specific bits of data
-    static const UINT32 s_MSK_D0 = 0x01;
-    static const UINT32 s_MSK_D1 = 0x02;
-    static const UINT32 s_MSK_D2 = 0x04;
-    static const UINT32 s_MSK_D3 = 0x08;
-    static const UINT32 s_MSK_D4 = 0x10;
-    static const UINT32 s_MSK_D5 = 0x20;
-    static const UINT32 s_MSK_D6 = 0x40;
-    static const UINT32 s_MSK_D7 = 0x80;
-    
-    static const UINT32 s_MSK_D0_TO_D3 = 0x0F;
-    static const UINT32 s_MSK_D2_TO_D5 = 0x3C;
-    static const UINT32 s_MSK_D6_D7 = 0xC0;
-    
-    static const UINT32 s_MSK_ALL = 0xFF;
-    
-    //Active High
-    static const UINT32 s_ACT_Hi = 0x00;
 
-        //
-        // CLunarLanderBaseGame
-        //
-    
+        static const ICpu::Interrupt c_interrupt = ICpu::IRQ0;
+};
+
+class CLunarLanderBaseGame : public CAtari6502Game<CLunarLanderBoard>
+{
     protected:
 
         CLunarLanderBaseGame(
-            const bool          clockMaster,
             const ROM_REGION    *romRegion,
             const INPUT_REGION  *inputRegion,
             const OUTPUT_REGION *outputRegion
         );
 
-        ~CLunarLanderBaseGame(
-        );
-
 };
 
 #endif
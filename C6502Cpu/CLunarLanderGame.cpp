@@ -171,35 +171,19 @@ IGame*
 CLunarLanderGame::createInstanceSet2(
 )
 {
-    return (new CLunarLanderGame(false, s_romRegionSet2));
-}
-
-IGame*
-CLunarLanderGame::createInstanceClockMasterSet2(
-)
-{
-    return (new CLunarLanderGame(true, s_romRegionSet2));
+    return (new CLunarLanderGame(s_romRegionSet2));
 }
 
 IGame*
 CLunarLanderGame::createInstanceSet1(
 )
 {
-    return (new CLunarLanderGame(false, s_romRegionSet1));
-}
-
-IGame*
-CLunarLanderGame::createInstanceClockMasterSet1(
-)
-{
-    return (new CLunarLanderGame(true, s_romRegionSet1));
+    return (new CLunarLanderGame(s_romRegionSet1));
 }
 
 CLunarLanderGame::CLunarLanderGame(
-    const bool       clockMaster,
     const ROM_REGION *romRegion
-) : CLunarLanderBaseGame( clockMaster,
-                           romRegion,
+) : CLunarLanderBaseGame( romRegion,
                            s_inputRegion,
                            s_outputRegion )
 {
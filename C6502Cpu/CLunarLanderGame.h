@@ -36,9 +36,7 @@ class CLunarLanderGame : public CLunarLanderBaseGame
         //
 
         static IGame* createInstanceSet2();
-        static IGame* createInstanceClockMasterSet2();
         static IGame* createInstanceSet1();
-        static IGame* createInstanceClockMasterSet1();
 
         //
         // IGame Interface - wholly implemented in the Base game.
@@ -50,7 +48,6 @@ class CLunarLanderGame : public CLunarLanderBaseGame
         // Different ROM sets supplied.
         //
         CLunarLanderGame(
-            const bool       clockMaster,
             const ROM_REGION *romRegion
         );
 
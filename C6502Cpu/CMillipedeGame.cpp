@@ -53,14 +53,8 @@ static const UINT32 s_ROM_ADDR_MN1 = 0x7000;
 //   not addressable by the CPU
 
 //
-// hardware addresses
-//
-static const UINT32 s_IRQ_RESET_ADDR = 0x2600;
-static const UINT32 s_EAROM_WRITE_ADDR = 0x2780;
-static const UINT32 s_EAROM_CONTROL_ADDR = 0x2700;
-static const UINT32 s_EAROM_READ_ADDR = 0x2030;
-static const UINT32 s_P1START_ADDRESS = 0x2000;  // address for P1START to confirm destructive EAROM operations
-static const UINT32 s_P1START_MASK = CCentipedeBaseGame::s_MSK_D5; // bitmask for P1START
+// hardware addresses - the IRQ reset and EAROM are in CMillipedeBoard
+//
 static const UINT32 s_POKEY_0_ADDR = 0x0400;
 static const UINT32 s_POKEY_1_ADDR = 0x0800;
 
@@ -75,6 +69,13 @@ static const ROM_REGION s_romRegionSet1[] PROGMEM = {
     {NO_BANK_SWITCH, s_ROM_ADDR_MN1, s_ROM_2732_SIZE, s_romData_1_MN1, 0x40711675, "MN1"},
     {0} }; // end of list
 
+//
+// Only the one set - identifying it is a quick check of every ROM's address lines
+//
+static const ROM_SET s_romSet[] PROGMEM = { //"0123456789"
+    {s_romRegionSet1,  "Milliped 1"},
+    {0} }; // end of list
+
 //
 // RAM regions
 //
@@ -131,27 +132,27 @@ static const RAM_REGION s_ramRegionWriteOnly[] PROGMEM = {
 //
 static const INPUT_REGION s_inputRegion[] PROGMEM = {
     //                                                        "012", "012345"
-    {NO_BANK_SWITCH, 0x0408,  CCentipedeBaseGame::s_MSK_ALL,  "4D ", "OPTSW0"}, // option switch block 1, on POKEY 0 (not directly readable?)
-    {NO_BANK_SWITCH, 0x0808,  CCentipedeBaseGame::s_MSK_ALL,  "4B ", "OPTSW1"}, // option switch block 2, on POKEY 1 (not directly readable?)
-
-    {NO_BANK_SWITCH, 0x2010,  CCentipedeBaseGame::s_MSK_D7,   "10K", "COIN R"}, // 10K pin 2, bit 7
-    {NO_BANK_SWITCH, 0x2010,  CCentipedeBaseGame::s_MSK_D6,   "10K", "COIN L"}, // 10K pin 5, bit 6
-    {NO_BANK_SWITCH, 0x2010,  CCentipedeBaseGame::s_MSK_D5,   "10K", "COINAX"}, // 10K pin 11, bit 5
-    {NO_BANK_SWITCH, 0x2010,  CCentipedeBaseGame::s_MSK_D4,   "10K", "SLAM  "},  // 10K pin 14 bit 4
-    {NO_BANK_SWITCH, 0x2010,  CCentipedeBaseGame::s_MSK_D0_TO_D3, "10K", "JYSTKS"}, // read 10K bits 0-3 as joystick inputs (two, selected by CTLSEL)
-    {NO_BANK_SWITCH, 0x2011,  CCentipedeBaseGame::s_MSK_D7,   "10K", "SlfTst"}, // Self-test switch, 10K pin 3, bit 7
-    {NO_BANK_SWITCH, 0x2011,  CCentipedeBaseGame::s_MSK_D5,   "10K", "CkTail"}, // Cocktail cabinet harness, 10K pin 10, bit 5
-    {NO_BANK_SWITCH, 0x2011,  CCentipedeBaseGame::s_MSK_D4,   "10K", "SPI?  "}, // Unknown (Pin 15 on main edge connector), 10K pin 13, bit 4
-
-    {NO_BANK_SWITCH, 0x2000,  CCentipedeBaseGame::s_MSK_D4,   "10L", "FIRE1 "}, // 10L pin 14, bit 4
-    {NO_BANK_SWITCH, 0x2001,  CCentipedeBaseGame::s_MSK_D4,   "10L", "FIRE2 "}, // 10L pin 13, bit 4
-    {NO_BANK_SWITCH, 0x2000,  CCentipedeBaseGame::s_MSK_D5,   "10L", "START1"}, // 10L pin 2, bit 5
-    {NO_BANK_SWITCH, 0x2001,  CCentipedeBaseGame::s_MSK_D5,   "10L", "START2"}, // 10L pin 3, bit 5
-    {NO_BANK_SWITCH, 0x2000,  CCentipedeBaseGame::s_MSK_D6,   "10L", "VBlank"}, // Vertical blank, 10L pin 11, bit 6
+    {NO_BANK_SWITCH, 0x0408,  CAtari6502BaseGame::s_MSK_ALL,  "4D ", "OPTSW0"}, // option switch block 1, on POKEY 0 (not directly readable?)
+    {NO_BANK_SWITCH, 0x0808,  CAtari6502BaseGame::s_MSK_ALL,  "4B ", "OPTSW1"}, // option switch block 2, on POKEY 1 (not directly readable?)
+
+    {NO_BANK_SWITCH, 0x2010,  CAtari6502BaseGame::s_MSK_D7,   "10K", "COIN R"}, // 10K pin 2, bit 7
+    {NO_BANK_SWITCH, 0x2010,  CAtari6502BaseGame::s_MSK_D6,   "10K", "COIN L"}, // 10K pin 5, bit 6
+    {NO_BANK_SWITCH, 0x2010,  CAtari6502BaseGame::s_MSK_D5,   "10K", "COINAX"}, // 10K pin 11, bit 5
+    {NO_BANK_SWITCH, 0x2010,  CAtari6502BaseGame::s_MSK_D4,   "10K", "SLAM  "},  // 10K pin 14 bit 4
+    {NO_BANK_SWITCH, 0x2010,  CAtari6502BaseGame::s_MSK_D0_TO_D3, "10K", "JYSTKS"}, // read 10K bits 0-3 as joystick inputs (two, selected by CTLSEL)
+    {NO_BANK_SWITCH, 0x2011,  CAtari6502BaseGame::s_MSK_D7,   "10K", "SlfTst"}, // Self-test switch, 10K pin 3, bit 7
+    {NO_BANK_SWITCH, 0x2011,  CAtari6502BaseGame::s_MSK_D5,   "10K", "CkTail"}, // Cocktail cabinet harness, 10K pin 10, bit 5
+    {NO_BANK_SWITCH, 0x2011,  CAtari6502BaseGame::s_MSK_D4,   "10K", "SPI?  "}, // Unknown (Pin 15 on main edge connector), 10K pin 13, bit 4
+
+    {NO_BANK_SWITCH, 0x2000,  CAtari6502BaseGame::s_MSK_D4,   "10L", "FIRE1 "}, // 10L pin 14, bit 4
+    {NO_BANK_SWITCH, 0x2001,  CAtari6502BaseGame::s_MSK_D4,   "10L", "FIRE2 "}, // 10L pin 13, bit 4
+    {NO_BANK_SWITCH, 0x2000,  CAtari6502BaseGame::s_MSK_D5,   "10L", "START1"}, // 10L pin 2, bit 5
+    {NO_BANK_SWITCH, 0x2001,  CAtari6502BaseGame::s_MSK_D5,   "10L", "START2"}, // 10L pin 3, bit 5
+    {NO_BANK_SWITCH, 0x2000,  CAtari6502BaseGame::s_MSK_D6,   "10L", "VBlank"}, // Vertical blank, 10L pin 11, bit 6
 
     // TO-DO custom test to option switches at same address (switched by TBEN 0x2505 D7)
-    {NO_BANK_SWITCH, 0x2000,  CCentipedeBaseGame::s_MSK_TRAK, "9P ", "TRAK-H"}, // Trak ball horizontal count and direction (9P bits 0-3 and 10L bit 7)
-    {NO_BANK_SWITCH, 0x2001,  CCentipedeBaseGame::s_MSK_TRAK, "8N ", "TRAK-V"}, // Trak ball vertical count and direction (8N bits 0-3 and 10L bit 7)
+    {NO_BANK_SWITCH, 0x2000,  CAtari6502BaseGame::s_MSK_TRAK, "9P ", "TRAK-H"}, // Trak ball horizontal count and direction (9P bits 0-3 and 10L bit 7)
+    {NO_BANK_SWITCH, 0x2001,  CAtari6502BaseGame::s_MSK_TRAK, "8N ", "TRAK-V"}, // Trak ball vertical count and direction (8N bits 0-3 and 10L bit 7)
     {0} // end of list
 };
 
@@ -159,16 +160,16 @@ static const INPUT_REGION s_inputRegion[] PROGMEM = {
 // Hardware Outputs
 //
 static const OUTPUT_REGION s_outputRegion[] PROGMEM = { //                                 "012", "012345"
-    {NO_BANK_SWITCH, 0x2501, CCentipedeBaseGame::s_MSK_D7,  CCentipedeBaseGame::s_ACT_Hi,  "12E", "CNCTLT"}, // 12E pin 5,  LEFT Coin counter
-    {NO_BANK_SWITCH, 0x2502, CCentipedeBaseGame::s_MSK_D7,  CCentipedeBaseGame::s_ACT_Hi,  "12E", "CNCTRT"}, // 12E pin 6,  RIGHT Coin counter
-    {NO_BANK_SWITCH, 0x2503, CCentipedeBaseGame::s_MSK_D7,  CCentipedeBaseGame::s_ACT_Lo,  "12E", "P1 LED"}, // 12E pin 7,  Player 1 start LED
-    {NO_BANK_SWITCH, 0x2504, CCentipedeBaseGame::s_MSK_D7,  CCentipedeBaseGame::s_ACT_Lo,  "12E", "P2 LED"}, // 12E pin 9,  Player 2 start LED
-    {NO_BANK_SWITCH, 0x2505, CCentipedeBaseGame::s_MSK_D7,  CCentipedeBaseGame::s_ACT_Lo,  "12E", "TBEN  "}, // 12E pin 10, Trak ball enable
-    {NO_BANK_SWITCH, 0x2506, CCentipedeBaseGame::s_MSK_D7,  CCentipedeBaseGame::s_ACT_Lo,  "12E", "VIDROT"}, // 12E pin 11, Video rotate
-    {NO_BANK_SWITCH, 0x2507, CCentipedeBaseGame::s_MSK_D7,  CCentipedeBaseGame::s_ACT_Lo,  "12E", "CTLSEL"}, // 12E pin 12, Control select
-
-    {NO_BANK_SWITCH, 0x2600, CCentipedeBaseGame::s_MSK_ALL, CCentipedeBaseGame::s_ACT_Lo,  "3F ", "IRQRST"}, // 3F pin 5, IRQ reset
-    {NO_BANK_SWITCH, 0x2680, CCentipedeBaseGame::s_MSK_ALL, CCentipedeBaseGame::s_ACT_Lo,  "3F ", "WD RST"}, // 3F pin 6, Clear watchdog timer
+    {NO_BANK_SWITCH, 0x2501, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Hi,  "12E", "CNCTLT"}, // 12E pin 5,  LEFT Coin counter
+    {NO_BANK_SWITCH, 0x2502, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Hi,  "12E", "CNCTRT"}, // 12E pin 6,  RIGHT Coin counter
+    {NO_BANK_SWITCH, 0x2503, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Lo,  "12E", "P1 LED"}, // 12E pin 7,  Player 1 start LED
+    {NO_BANK_SWITCH, 0x2504, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Lo,  "12E", "P2 LED"}, // 12E pin 9,  Player 2 start LED
+    {NO_BANK_SWITCH, 0x2505, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Lo,  "12E", "TBEN  "}, // 12E pin 10, Trak ball enable
+    {NO_BANK_SWITCH, 0x2506, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Lo,  "12E", "VIDROT"}, // 12E pin 11, Video rotate
+    {NO_BANK_SWITCH, 0x2507, CAtari6502BaseGame::s_MSK_D7,  CAtari6502BaseGame::s_ACT_Lo,  "12E", "CTLSEL"}, // 12E pin 12, Control select
+
+    {NO_BANK_SWITCH, 0x2600, CAtari6502BaseGame::s_MSK_ALL, CAtari6502BaseGame::s_ACT_Lo,  "3F ", "IRQRST"}, // 3F pin 5, IRQ reset
+    {NO_BANK_SWITCH, 0x2680, CAtari6502BaseGame::s_MSK_ALL, CAtari6502BaseGame::s_ACT_Lo,  "3F ", "WD RST"}, // 3F pin 6, Clear watchdog timer
     {0} // end of list
 };
 
@@ -177,11 +178,22 @@ static const OUTPUT_REGION s_outputRegion[] PROGMEM = { //
 //
 static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = {
     //                                    "0123456789"
-//    {CCentipedeBaseGame::earomIdle,       "EAROM Idle"},
-    {CCentipedeBaseGame::earomReadTest,   "EAROM Read"},
-    {CCentipedeBaseGame::earomSerialDump, "EAROM Dump"},
-    {CCentipedeBaseGame::earomSerialLoad, "EAROM Load"},
-    {CCentipedeBaseGame::earomErase,      "EAROM Wipe"},
+//    {CAtari6502BaseGame::earomIdle,       "EAROM Idle"},
+    {CAtari6502BaseGame::earomReadTest,   "EAROM Read"},
+    {CAtari6502BaseGame::earomSerialDump, "EAROM Dump"},
+    {CAtari6502BaseGame::earomSerialLoad, "EAROM Load"},
+    {CAtari6502BaseGame::earomErase,      "EAROM Wipe"},
+    {CAtari6502BaseGame::romIdentify,     "ROM Ident "},
+    {CAtari6502BaseGame::romVerify,       "ROM BlkMap"},
+    {CAtari6502BaseGame::romVerifyFirstBlock, "ROM Blk1st"},
+    {CAtari6502BaseGame::romSample,           "ROM Sample"},
+    {CAtari6502BaseGame::romQuick,            "ROM Quick "},
+    {CAtari6502BaseGame::romDump,             "ROM Dump  "},
+    {CAtari6502BaseGame::romCompare,          "ROM Comp  "},
+    {CAtari6502BaseGame::romLearn,            "ROM Learn "},
+    {CAtari6502BaseGame::romLearnLayout,      "ROM Layout"},
+    {CAtari6502BaseGame::romChecksum,         "ROM Cksum "},
+    {CCrc32::benchmark,                   "CRC Bench "},
     {NO_CUSTOM_FUNCTION} // end of list
 };
 
@@ -189,33 +201,19 @@ IGame*
 CMillipedeGame::createInstanceSet1(
 )
 {
-    return (new CMillipedeGame(false, s_romRegionSet1));
-}
-
-IGame*
-CMillipedeGame::createInstanceClockMasterSet1(
-)
-{
-    return (new CMillipedeGame(true, s_romRegionSet1));
+    return (new CMillipedeGame(s_romRegionSet1));
 }
 
 CMillipedeGame::CMillipedeGame(
-               const bool       clockMaster,
                const ROM_REGION *romRegion
-               ) : CCentipedeBaseGame( clockMaster,
-                                       romRegion,
-                                       s_ramRegion,
-                                       s_ramRegionByteOnly,
-                                       s_ramRegionWriteOnly,
-                                       s_inputRegion,
-                                       s_outputRegion,
-                                       s_customFunction,
-                                       s_IRQ_RESET_ADDR,
-                                       s_EAROM_WRITE_ADDR,
-                                       s_EAROM_CONTROL_ADDR,
-                                       s_EAROM_READ_ADDR,
-                                       s_P1START_ADDRESS,
-                                       s_P1START_MASK
-                                      )
+               ) : CAtari6502Game( romRegion,
+                                   s_romSet,
+                                   s_ramRegion,
+                                   s_ramRegionByteOnly,
+                                   s_ramRegionWriteOnly,
+                                   s_inputRegion,
+                                   s_outputRegion,
+                                   s_customFunction
+                                  )
 {
 }
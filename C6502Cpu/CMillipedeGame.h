@@ -26,9 +26,30 @@
 #ifndef CMillipedeGame_h
 #define CMillipedeGame_h
 
-#include "CCentipedeBaseGame.h"
+#include "CAtari6502Game.h"
 
-class CMillipedeGame : public CCentipedeBaseGame
+//
+// The Centipede board with the IRQ reset and EAROM moved. P1 START is active low.
+//
+class CMillipedeBoard : public CAtari6502Board
+{
+    public:
+
+        static const ICpu::Interrupt c_interrupt = ICpu::IRQ0;
+        static const UINT8  c_interruptLoops = 10;
+        static const UINT16 c_interruptInactiveMs = 1;
+        static const UINT16 c_interruptResetAddress = 0x2600;
+
+        static const UINT16 c_earomWriteAddress = 0x2780;
+        static const UINT16 c_earomControlAddress = 0x2700;
+        static const UINT16 c_earomReadAddress = 0x2030;
+        static const UINT8  c_earomMapping = EAROM_C1D1_C2D2;
+        static const UINT16 c_earomConfirmAddress = 0x2000;
+        static const UINT8  c_earomConfirmMask = CAtari6502BaseGame::s_MSK_D5;
+        static const bool   c_earomConfirmActiveLow = true;
+};
+
+class CMillipedeGame : public CAtari6502Game<CMillipedeBoard>
 {
 public:
     
@@ -36,7 +57,6 @@ public:
     // Constructors for this game.
     //
     static IGame* createInstanceSet1();
-    static IGame* createInstanceClockMasterSet1();
 
 private:
     
@@ -44,7 +64,6 @@ private:
     // Different ROM sets supplied.
     //
     CMillipedeGame(
-                    const bool       clockMaster,
                     const ROM_REGION *romRegion
                     );
 
@@ -25,74 +25,44 @@
 #ifndef CASpaceDuelBaseGame_h
 #define CASpaceDuelBaseGame_h
 
-#include "CGame.h"
-#include "CER2055.h"
+#include "CAtari6502Game.h"
 
-class CSpaceDuelBaseGame : public CGame
+//
+// IRQ fires every 4(?) ms and is cleared by a write to IRQRES. NMI is not used.
+// START is active high.
+//
+class CSpaceDuelBoard : public CAtari6502Board
 {
     public:
-    
-        PERROR interruptCheck();
 
-        //
-        // custom tests for the EAROM
-        //
-        static PERROR earomIdle( void *cSpaceDuelGame );
-        static PERROR earomReadTest( void *cSpaceDuelGame );
-        static PERROR earomErase( void *cSpaceDuelGame );
-        static PERROR earomSerialDump( void *cSpaceDuelGame );
-        static PERROR earomSerialLoad( void *cSpaceDuelGame );
-    
-        //Bit masks - used to test inputs etc by masking / selecting specific bits of data
-        static const UINT32 s_MSK_D0 = 0x01;
-        static const UINT32 s_MSK_D1 = 0x02;
-        static const UINT32 s_MSK_D2 = 0x04;
-        static const UINT32 s_MSK_D3 = 0x08;
-        static const UINT32 s_MSK_D4 = 0x10;
-        static const UINT32 s_MSK_D5 = 0x20;
-        static const UINT32 s_MSK_D6 = 0x40;
-        static const UINT32 s_MSK_D7 = 0x80;
-    
-        static const UINT32 s_MSK_D0_TO_D3 = 0x0F;
-        static const UINT32 s_MSK_D2_TO_D5 = 0x3C;
-        static const UINT32 s_MSK_D6_D7 = 0xC0;
-    
-        static const UINT32 s_MSK_ALL = 0xFF;
-    
-        static const UINT32 s_ACT_Hi = 0x00; //Active High
-        static const UINT32 s_ACT_Lo = 0x01; //Active Low
-   
+        static const ICpu::Interrupt c_interrupt = ICpu::IRQ0;
+        static const UINT8  c_interruptLoops = 10;
+        static const UINT16 c_interruptInactiveMs = 1;
+        static const UINT16 c_interruptResetAddress = 0x0e00;
+
+        static const UINT16 c_earomWriteAddress = 0x0f00;
+        static const UINT16 c_earomControlAddress = 0x0e80;
+        static const UINT16 c_earomReadAddress = 0x0a00;
+        static const UINT8  c_earomMapping = EAROM_C1D2_C2D1;
+        static const UINT16 c_earomConfirmAddress = 0x0904;
+        static const UINT8  c_earomConfirmMask = CAtari6502BaseGame::s_MSK_D6;
+        static const bool   c_earomConfirmActiveLow = false;
+};
+
+class CSpaceDuelBaseGame : public CAtari6502Game<CSpaceDuelBoard>
+{
     protected:
 
         CSpaceDuelBaseGame(
-            const bool          clockMaster,
             const ROM_DATA2N    *romData2n,
             const ROM_REGION    *romRegion,
             const RAM_REGION    *ramRegion,
             const RAM_REGION    *ramRegionByteOnly,
             const RAM_REGION    *ramRegionWriteOnly,
             const INPUT_REGION  *inputRegion,
-            const OUTPUT_REGION *outputRegion,
-            const UINT16        irqResetAddress,
-            const UINT16        pokey0Address,
-            const UINT16        pokey1Address,
-            const UINT16        earomWriteBaseAddress,
-            const UINT16        earomControlAddress,
-            const UINT16        earomReadAddress,
-            const UINT16        confirmAddress,
-            const UINT8         confirmMask,
-            const bool          confirmActiveLow
-        );
-
-        ~CSpaceDuelBaseGame(
+            const OUTPUT_REGION *outputRegion
         );
 
-        UINT16 m_irqResetAddress;
-        UINT16 m_confirmAddress;
-        UINT8  m_confirmMask;
-        bool   m_confirmActiveLow;
-        CER2055 *m_earom;
-
 };
 
 #endif
@@ -143,17 +143,10 @@ static const RAM_REGION s_ramRegionWriteOnly[] PROGMEM = {
 };
 
 //
-// Hardware addresses
+// Hardware addresses - the IRQ reset and EAROM are in CSpaceDuelBoard
 //
-static const UINT16 s_IRQ_RESET_ADDR = 0x0e00;
 static const UINT16 s_POKEY0_ADDR = 0x1000;
 static const UINT16 s_POKEY1_ADDR = 0x1400;
-static const UINT16 s_EAROM_WRITE_ADDR = 0x0f00;
-static const UINT16 s_EAROM_CONTROL_ADDR = 0x0e80;
-static const UINT16 s_EAROM_READ_ADDR = 0x0a00;
-static const UINT16 s_CONF_ADDRESS = 0x0904;  // address for START button to confirm destructive EAROM operations
-static const UINT8  s_CONF_MASK = (UINT8)CSpaceDuelBaseGame::s_MSK_D6; // bitmask for START button
-static const bool   s_CONF_ACTIVE_LOW =  false; // START button is active high
 
 //
 // Input region
@@ -217,51 +210,26 @@ IGame*
 CSpaceDuelGame::createInstanceSet1(
 )
 {
-    return (new CSpaceDuelGame(false, s_romData2nSet1, s_romRegionSet1));
-}
-
-IGame*
-CSpaceDuelGame::createInstanceClockMasterSet1(
-)
-{
-    return (new CSpaceDuelGame(true, s_romData2nSet1, s_romRegionSet1));
+    return (new CSpaceDuelGame(s_romData2nSet1, s_romRegionSet1));
 }
 
 IGame*
 CSpaceDuelGame::createInstanceSet2(
 )
 {
-    return (new CSpaceDuelGame(false, s_romData2nSet2, s_romRegionSet2));
-}
-
-IGame*
-CSpaceDuelGame::createInstanceClockMasterSet2(
-)
-{
-    return (new CSpaceDuelGame(true, s_romData2nSet2, s_romRegionSet2));
+    return (new CSpaceDuelGame(s_romData2nSet2, s_romRegionSet2));
 }
 
 CSpaceDuelGame::CSpaceDuelGame(
-                               const bool       clockMaster,
                                const ROM_DATA2N *romData2n,
                                const ROM_REGION *romRegion
-                               ) : CSpaceDuelBaseGame( clockMaster,
-                                                      romData2n,
+                               ) : CSpaceDuelBaseGame( romData2n,
                                                       romRegion,
                                                       s_ramRegion,
                                                       s_ramRegionByteOnly,
                                                       s_ramRegionWriteOnly,
                                                       s_inputRegion,
-                                                      s_outputRegion,
-                                                      s_IRQ_RESET_ADDR,
-                                                      s_POKEY0_ADDR,
-                                                      s_POKEY1_ADDR,
-                                                      s_EAROM_WRITE_ADDR,
-                                                      s_EAROM_CONTROL_ADDR,
-                                                      s_EAROM_READ_ADDR,
-                                                      s_CONF_ADDRESS,
-                                                      s_CONF_MASK,
-                                                      s_CONF_ACTIVE_LOW
+                                                      s_outputRegion
                                                       )
 {
 }
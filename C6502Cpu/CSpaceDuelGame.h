@@ -35,9 +35,7 @@ class CSpaceDuelGame : public CSpaceDuelBaseGame
         // Constructors for this game.
         //
         static IGame* createInstanceSet1();
-        static IGame* createInstanceClockMasterSet1();
         static IGame* createInstanceSet2();
-        static IGame* createInstanceClockMasterSet2();
 
     private:
 
@@ -45,7 +43,6 @@ class CSpaceDuelGame : public CSpaceDuelBaseGame
         // Different ROM sets supplied.
         //
         CSpaceDuelGame(
-            const bool       clockMaster,
             const ROM_DATA2N *romData2n,
             const ROM_REGION *romRegion
         );
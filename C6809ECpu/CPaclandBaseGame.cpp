@@ -48,6 +48,34 @@ static const UINT8  c_MPAGE_8H_Hi  = 0x05;
 static const UINT8  c_MPAGE_8J_Lo  = 0x06;
 static const UINT8  c_MPAGE_8J_Hi  = 0x07;
 
+//
+// Bank switch writes - indexed by CPaclandBaseGame::MPAGE_BANK
+//
+static const BANK_SELECT s_bankSelect[CPaclandBaseGame::MPAGE_BANKS] PROGMEM = {
+    {c_MPAGE, c_MPAGE_8E_Lo},
+    {c_MPAGE, c_MPAGE_8E_Hi},
+    {c_MPAGE, c_MPAGE_8F_Lo},
+    {c_MPAGE, c_MPAGE_8F_Hi},
+    {c_MPAGE, c_MPAGE_8H_Lo},
+    {c_MPAGE, c_MPAGE_8H_Hi},
+    {c_MPAGE, c_MPAGE_8J_Lo},
+    {c_MPAGE, c_MPAGE_8J_Hi}
+};
+
+//
+// Bank switch callbacks - indexed by CPaclandBaseGame::MPAGE_BANK
+//
+static const BankSwitchCallback s_bankSwitch[CPaclandBaseGame::MPAGE_BANKS] PROGMEM = {
+    CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8E_Lo>,
+    CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8E_Hi>,
+    CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8F_Lo>,
+    CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8F_Hi>,
+    CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8H_Lo>,
+    CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8H_Hi>,
+    CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8J_Lo>,
+    CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8J_Hi>
+};
+
 //
 // Write-only RAM region
 //
@@ -165,13 +193,27 @@ static const OUTPUT_REGION s_outputRegion[] PROGMEM = { //
 //
 // Custom functions implemented for this game.
 //
-static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = { //                                               "0123456789"
-                                                             {CPaclandBaseGame::testClockPulse,              "Clk Pulse "},
+static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = { //                                                  "0123456789"
+                                                             {CPaclandBaseGame::testClockPulse,                 "Clk Pulse "},
+                                                             {CPaclandBaseGame::testBankLatch,                  "Bank Latch"},
+                                                             {CPaclandBaseGame::romTest<ROM_TEST_IDENTIFY>,     "ROM Ident "},
+                                                             {CPaclandBaseGame::romTest<ROM_TEST_VERIFY>,       "ROM BlkMap"},
+                                                             {CPaclandBaseGame::romTest<ROM_TEST_VERIFY_FIRST>, "ROM Blk1st"},
+                                                             {CPaclandBaseGame::romTest<ROM_TEST_SAMPLE>,       "ROM Sample"},
+                                                             {CPaclandBaseGame::romTest<ROM_TEST_QUICK>,        "ROM Quick "},
+                                                             {CPaclandBaseGame::romTest<ROM_TEST_DUMP>,         "ROM Dump  "},
+                                                             {CPaclandBaseGame::romTest<ROM_TEST_COMPARE>,      "ROM Comp  "},
+                                                             {CPaclandBaseGame::romTest<ROM_TEST_LEARN>,        "ROM Learn "},
+                                                             {CPaclandBaseGame::romTest<ROM_TEST_LAYOUT>,       "ROM Layout"},
+                                                             {CPaclandBaseGame::romTest<ROM_TEST_CHIPS>,        "ROM Chips "},
+                                                             {CCrc32::benchmark,                                "CRC Bench "},
     {NO_CUSTOM_FUNCTION}
 }; // end of list
 
 CPaclandBaseGame::CPaclandBaseGame(
-                                   const ROM_REGION    *romRegion
+                                   const ROM_REGION    *romRegion,
+                                   const ROM_SET       *romSet,
+                                   const ROM_CHIP      *romChip
                                    ) : CGame( romRegion,
                                              s_ramRegion,
                                              s_ramRegionByteOnly,
@@ -179,7 +221,9 @@ CPaclandBaseGame::CPaclandBaseGame(
                                              s_inputRegion,
                                              s_outputRegion,
                                              s_customFunction ),
-                                        m_clockPulseCount(0)
+                                        m_clockPulseCount(0),
+                                        m_romSet(romSet),
+                                        m_romChip(romChip)
 {
     m_cpu = new C6809ECpu(8); //8 = number of clocks to wait before clocking in data
     m_cpu->idle();
@@ -194,95 +238,58 @@ CPaclandBaseGame::~CPaclandBaseGame(
 }
 
 
-// Bank switching functions
+// Bank switching
 // Need to write magic number to specific location to swap in a particular RAM slice
 // at a predefined CPU accessible address range.
+// The ROM tables reference onBankSwitchMPAGE<bank> which looks the write up here.
 PERROR
-CPaclandBaseGame::onBankSwitchMPAGE_8E_Lo(
-                                     void *cPaclandBaseGame
-                                     )
-{
-    CPaclandBaseGame *thisGame  = (CPaclandBaseGame *) cPaclandBaseGame;
-    ICpu              *cpu       = thisGame->m_cpu;
-    
-    return cpu->memoryWrite(c_MPAGE, c_MPAGE_8E_Lo);
-}
-
-PERROR
-CPaclandBaseGame::onBankSwitchMPAGE_8E_Hi(
-                                          void *cPaclandBaseGame
-                                          )
+CPaclandBaseGame::selectBank(
+                             void       *cPaclandBaseGame,
+                             MPAGE_BANK bank
+                             )
 {
     CPaclandBaseGame *thisGame  = (CPaclandBaseGame *) cPaclandBaseGame;
-    ICpu              *cpu       = thisGame->m_cpu;
     
-    return cpu->memoryWrite(c_MPAGE, c_MPAGE_8E_Hi);
-}
-
-PERROR
-CPaclandBaseGame::onBankSwitchMPAGE_8F_Lo(
-                                          void *cPaclandBaseGame
-                                          )
-{
-    CPaclandBaseGame *thisGame  = (CPaclandBaseGame *) cPaclandBaseGame;
-    ICpu              *cpu       = thisGame->m_cpu;
-    
-    return cpu->memoryWrite(c_MPAGE, c_MPAGE_8F_Lo);
-}
-
-PERROR
-CPaclandBaseGame::onBankSwitchMPAGE_8F_Hi(
-                                          void *cPaclandBaseGame
-                                          )
-{
-    CPaclandBaseGame *thisGame  = (CPaclandBaseGame *) cPaclandBaseGame;
-    ICpu              *cpu       = thisGame->m_cpu;
-    
-    return cpu->memoryWrite(c_MPAGE, c_MPAGE_8F_Hi);
-}
-
-PERROR
-CPaclandBaseGame::onBankSwitchMPAGE_8H_Lo(
-                                          void *cPaclandBaseGame
-                                          )
-{
-    CPaclandBaseGame *thisGame  = (CPaclandBaseGame *) cPaclandBaseGame;
-    ICpu              *cpu       = thisGame->m_cpu;
-    
-    return cpu->memoryWrite(c_MPAGE, c_MPAGE_8H_Lo);
+    return CRomSchedule::bankSelect(thisGame->m_cpu, &s_bankSelect[bank]);
 }
 
+//
+// Select each MPAGE bank and read back one byte that only that bank holds (8 - 16 reads).
+// latchFault is set if the window showed another bank rather than an unknown byte.
+//
 PERROR
-CPaclandBaseGame::onBankSwitchMPAGE_8H_Hi(
-                                          void *cPaclandBaseGame
-                                          )
+CPaclandBaseGame::checkBankLatch(
+                                 bool   *latchFault
+                                 )
 {
-    CPaclandBaseGame *thisGame  = (CPaclandBaseGame *) cPaclandBaseGame;
-    ICpu              *cpu       = thisGame->m_cpu;
+    CBankCheck bankCheck(m_cpu, this, s_bankSelect, s_bankSwitch, MPAGE_BANKS);
     
-    return cpu->memoryWrite(c_MPAGE, c_MPAGE_8H_Hi);
+    return bankCheck.check(m_romRegion, latchFault);
 }
 
+//
+// Run before the banked ROM tests so a latch fault is reported as such rather than
+// after every bank has been read and failed in turn.
+//
 PERROR
-CPaclandBaseGame::onBankSwitchMPAGE_8J_Lo(
-                                          void *cPaclandBaseGame
-                                          )
+CPaclandBaseGame::preCheckBankLatch(
+                                    )
 {
-    CPaclandBaseGame *thisGame  = (CPaclandBaseGame *) cPaclandBaseGame;
-    ICpu              *cpu       = thisGame->m_cpu;
+    bool latchFault = false;
+    PERROR error = checkBankLatch(&latchFault);
     
-    return cpu->memoryWrite(c_MPAGE, c_MPAGE_8J_Lo);
+    return latchFault ? error : errorSuccess;
 }
 
 PERROR
-CPaclandBaseGame::onBankSwitchMPAGE_8J_Hi(
-                                          void *cPaclandBaseGame
-                                          )
+CPaclandBaseGame::testBankLatch(
+                                void   *context
+                                )
 {
-    CPaclandBaseGame *thisGame  = (CPaclandBaseGame *) cPaclandBaseGame;
-    ICpu              *cpu       = thisGame->m_cpu;
+    CPaclandBaseGame *thisGame = (CPaclandBaseGame *) context;
+    bool latchFault = false;
     
-    return cpu->memoryWrite(c_MPAGE, c_MPAGE_8J_Hi);
+    return thisGame->checkBankLatch(&latchFault);
 }
 
 PERROR
@@ -304,6 +311,26 @@ CPaclandBaseGame::testClockPulse(
     return error;
 }
 
+PERROR
+CPaclandBaseGame::runRomTest(
+                             ROM_TEST test
+                             )
+{
+    PERROR error = errorSuccess;
+    
+    // A layout sent over serial may not be a Pacland board.
+    if ((test != ROM_TEST_IDENTIFY) && (test != ROM_TEST_LAYOUT))
+    {
+        error = preCheckBankLatch();
+        if (FAILED(error))
+        {
+            return error;
+        }
+    }
+    
+    return CRomTests::run(test, m_cpu, this, m_romRegion, m_romSet, m_romChip);
+}
+
 
 
 // ******** PACLAND MAME
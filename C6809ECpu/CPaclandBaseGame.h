@@ -26,6 +26,9 @@
 #define CPaclandBaseGame_h
 
 #include "CGame.h"
+#include "CRomTests.h"
+#include "CRomSchedule.h"
+#include "CBankCheck.h"
 
 
 class CPaclandBaseGame : public CGame
@@ -36,55 +39,80 @@ public:
     // CPaclandBaseGame
     //
     
-    //Bank switched ROMs
-    static PERROR onBankSwitchMPAGE_8E_Lo(
-                                          void *cPaclandBaseGame
-                                          );
+    //Bank switched ROMs - the slice of 8E, 8F, 8H or 8J paged in at 0x4000 - 0x5FFF
+    enum MPAGE_BANK {
+        MPAGE_8E_Lo,
+        MPAGE_8E_Hi,
+        MPAGE_8F_Lo,
+        MPAGE_8F_Hi,
+        MPAGE_8H_Lo,
+        MPAGE_8H_Hi,
+        MPAGE_8J_Lo,
+        MPAGE_8J_Hi,
+        MPAGE_BANKS
+    };
     
-    static PERROR onBankSwitchMPAGE_8E_Hi(
-                                          void *cPaclandBaseGame
-                                          );
-    
-    static PERROR onBankSwitchMPAGE_8F_Lo(
-                                          void *cPaclandBaseGame
-                                          );
-    
-    static PERROR onBankSwitchMPAGE_8F_Hi(
-                                          void *cPaclandBaseGame
-                                          );
-    
-    static PERROR onBankSwitchMPAGE_8H_Lo(
-                                          void *cPaclandBaseGame
-                                          );
-    
-    static PERROR onBankSwitchMPAGE_8H_Hi(
-                                          void *cPaclandBaseGame
-                                          );
-    
-    static PERROR onBankSwitchMPAGE_8J_Lo(
-                                          void *cPaclandBaseGame
-                                          );
-    
-    static PERROR onBankSwitchMPAGE_8J_Hi(
-                                          void *cPaclandBaseGame
-                                          );
+    // ROM_REGION only carries a callback, not data, so each bank still needs its own
+    // thunk - the bank register and value come from s_bankSelect.
+    template <MPAGE_BANK bank>
+    static PERROR onBankSwitchMPAGE(
+                                    void *cPaclandBaseGame
+                                    )
+    {
+        return selectBank(cPaclandBaseGame, bank);
+    }
     
     //Clock test
     static PERROR testClockPulse(
                                  void   *context
                                  );
     
+    //MPAGE latch check - every bank read back through the 0x4000 window
+    static PERROR testBankLatch(
+                                void   *context
+                                );
+    
+    //ROM tools - see CRomTests.h. All but ROM Ident and ROM Layout check the bank latch first.
+    template <ROM_TEST test>
+    static PERROR romTest(
+                          void   *context
+                          )
+    {
+        return ((CPaclandBaseGame *) context)->runRomTest(test);
+    }
+    
 protected:
     
     CPaclandBaseGame(
-    const ROM_REGION *romRegion
+    const ROM_REGION *romRegion,
+    const ROM_SET    *romSet,
+    const ROM_CHIP   *romChip
     );
     
     ~CPaclandBaseGame(
     );
     
 private:
+    
+    static PERROR selectBank(
+                             void       *cPaclandBaseGame,
+                             MPAGE_BANK bank
+                             );
+    
+    PERROR checkBankLatch(
+                          bool   *latchFault
+                          );
+    
+    PERROR preCheckBankLatch(
+                             );
+    
+    PERROR runRomTest(
+                      ROM_TEST test
+                      );
+    
     UINT32 m_clockPulseCount;
+    const ROM_SET *m_romSet;
+    const ROM_CHIP *m_romChip;
     
 };
 
@@ -79,8 +79,8 @@ static const UINT32 s_PL_ROM_SIZE = 0x4000; //Size of ROM
 //  - 0x2000 bytes (max address 0x1FFF) has 13 data samples.
 //  - 0x4000 bytes (max address 0x3FFF) has 14 data samples.
 //
-// Use 'rom_idx_dump.sh' to generate these dumps for you!
-// If you need a ROM slice first then use 'rom_splitter.sh'
+// Use 'extras/rom_table_gen.cpp' to generate these dumps for you!
+// It cuts the banked ROMs into slices with '-w 0x2000 -a 0x4000'
 
 // Default set from MAME.
 //
@@ -141,181 +141,159 @@ static const UINT32 s_PL_ROM_SIZE = 0x4000; //Size of ROM
 //00000110 0x06 Pages in ROM PL1-6 / PL3-6 Lower 8J
 //00000111 0x07 Pages in ROM PL1-6 / PL3-6 Upper 8J
 
+//Each ROM once - see RomSet.h.
+//Program ROMs - the hiscore mods change only the CRC so these take it.
+#define PL_ROM_8B(data2n, crc) {NO_BANK_SWITCH, s_PL_8B_ROM, s_PL_ROM_SIZE, data2n, crc, "8B "}  //0x8000 0xBFFF -> 4000 size
+#define PL_ROM_8D(data2n, crc) {NO_BANK_SWITCH, s_PL_8D_ROM, s_PL_ROM_SIZE, data2n, crc, "8D "}  //0xC000 0xFFFF -> 4000 size
+
+//Banked ROM slices
+#define PL1_3_8E_LO  {CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8E_Lo>, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Lo,    0xA9EFA48D, "8E0"} //  Lo - write 0x00 to 0x3c00
+#define PL1_3_8E_HI  {CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8E_Hi>, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Hi,    0x3ABCB7CD, "8E1"} //  Hi - write 0x01 to 0x3c00
+#define PL1_4_8F_LO  {CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8F_Lo>, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Lo,    0x1A11C805, "8F0"} //  Lo - write 0x02 to 0x3c00
+#define PL1_4_8F_HI  {CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8F_Hi>, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Hi,    0x517D4DB8, "8F1"} //  Hi - write 0x03 to 0x3c00
+#define PL1_5_8H_LO  {CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8H_Lo>, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Lo,    0x570B72EA, "8H0"} //  Lo - write 0x04 to 0x3c00
+#define PL1_5_8H_HI  {CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8H_Hi>, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Hi,    0x872C56C0, "8H1"} //  Hi - write 0x05 to 0x3c00
+#define PL_8J_LO     {CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8J_Lo>, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL3_06_8J_Lo,    0xAF660BE5, "8J0"} //  Lo - write 0x06 to 0x3c00 - PL3_6 and PL1_6 alike
+#define PL3_6_8J_HI  {CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8J_Hi>, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL3_06_8J_Hi,    0xC99CC9E9, "8J1"} //  Hi - write 0x07 to 0x3c00
+#define PL1_6_8J_HI  {CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8J_Hi>, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romDataAlt_PL1_06_8J_Hi, 0x567CA359, "8J1"}
+
+//Banked ROMs of the Namco sets (PL3_6 at 8J) and of the Japan, Japan Old and Midway sets (PL1_6 at 8J)
+#define PL_BANKED_ROMS_PL3_6 PL1_3_8E_LO, PL1_3_8E_HI, PL1_4_8F_LO, PL1_4_8F_HI, PL1_5_8H_LO, PL1_5_8H_HI, PL_8J_LO, PL3_6_8J_HI
+#define PL_BANKED_ROMS_PL1_6 PL1_3_8E_LO, PL1_3_8E_HI, PL1_4_8F_LO, PL1_4_8F_HI, PL1_5_8H_LO, PL1_5_8H_HI, PL_8J_LO, PL1_6_8J_HI
+
+static const UINT8 s_PL_ROM_COUNT = 10;
+
 //Pacland - Namco.
 //
 //
 static const ROM_REGION s_romRegion[] PROGMEM =     {
-    //Program ROMs
-    {NO_BANK_SWITCH,                            s_PL_8B_ROM,        s_PL_ROM_SIZE,         s_romData_PL5_01B_8B,    0xB0EA7631, "8B "},  //0x8000 0xBFFF -> 4000 size
-    {NO_BANK_SWITCH,                            s_PL_8D_ROM,        s_PL_ROM_SIZE,         s_romData_PL5_02_8D,     0xD903E84E, "8D "},  //0xC000 0xFFFF -> 4000 size
-    
-    //Banked ROMs
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Lo,  0xA9EFA48D, "8E0"}, //  Lo - write 0x00 to 0x3c00
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Hi,  0x3ABCB7CD, "8E1"}, //  Hi - write 0x01 to 0x3c00
-    
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Lo,  0x1A11C805, "8F0"}, //  Lo - write 0x02 to 0x3c00
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Hi,  0x517D4DB8, "8F1"}, //  Hi - write 0x03 to 0x3c00
-    
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Lo,  0x570B72EA, "8H0"}, //  Lo - write 0x04 to 0x3c00
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Hi,  0x872C56C0, "8H1"}, //  Hi - write 0x05 to 0x3c00
-    
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL3_06_8J_Lo,  0xAF660BE5, "8J0"}, //  Lo - write 0x06 to 0x3c00
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL3_06_8J_Hi,  0xC99CC9E9, "8J1"}, //  Hi - write 0x07 to 0x3c00
-
+    PL_ROM_8B(s_romData_PL5_01B_8B, 0xB0EA7631),
+    PL_ROM_8D(s_romData_PL5_02_8D,  0xD903E84E),
+    PL_BANKED_ROMS_PL3_6,
     {0} }; // end of list
+ROM_SET_CHECK(s_romRegion, s_PL_ROM_COUNT);
 
 //Pacland - Namco - with hiscore mod
 static const ROM_REGION s_romRegion_Hi[] PROGMEM =     {
-    {NO_BANK_SWITCH,                            s_PL_8B_ROM,        s_PL_ROM_SIZE,         s_romData_PL5_01B_8B,    0xB0EA7631, "8B "},
-    {NO_BANK_SWITCH,                            s_PL_8D_ROM,        s_PL_ROM_SIZE,         s_romData_PL5_02_8D,     0x4DDA0854, "8D "}, //Hiscore CRC
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Lo,  0xA9EFA48D, "8E0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Hi,  0x3ABCB7CD, "8E1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Lo,  0x1A11C805, "8F0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Hi,  0x517D4DB8, "8F1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Lo,  0x570B72EA, "8H0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Hi,  0x872C56C0, "8H1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL3_06_8J_Lo,  0xAF660BE5, "8J0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL3_06_8J_Hi,  0xC99CC9E9, "8J1"},
+    PL_ROM_8B(s_romData_PL5_01B_8B, 0xB0EA7631),
+    PL_ROM_8D(s_romData_PL5_02_8D,  0x4DDA0854), //Hiscore CRC
+    PL_BANKED_ROMS_PL3_6,
     {0} }; // end of list
+ROM_SET_CHECK(s_romRegion_Hi, s_PL_ROM_COUNT);
 
 //Pacland - Namco - with hiscore mod and software highscore reset feature
 static const ROM_REGION s_romRegion_Hi_Rst[] PROGMEM =     {
-    {NO_BANK_SWITCH,                            s_PL_8B_ROM,        s_PL_ROM_SIZE,         s_romData_PL5_01B_8B,    0xB0EA7631, "8B "},
-    {NO_BANK_SWITCH,                            s_PL_8D_ROM,        s_PL_ROM_SIZE,         s_romData_PL5_02_8D,     0xFF0B7D1D, "8D "}, //Hiscore with Reset CRC
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Lo,  0xA9EFA48D, "8E0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Hi,  0x3ABCB7CD, "8E1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Lo,  0x1A11C805, "8F0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Hi,  0x517D4DB8, "8F1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Lo,  0x570B72EA, "8H0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Hi,  0x872C56C0, "8H1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL3_06_8J_Lo,  0xAF660BE5, "8J0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL3_06_8J_Hi,  0xC99CC9E9, "8J1"},
+    PL_ROM_8B(s_romData_PL5_01B_8B, 0xB0EA7631),
+    PL_ROM_8D(s_romData_PL5_02_8D,  0xFF0B7D1D), //Hiscore with Reset CRC
+    PL_BANKED_ROMS_PL3_6,
     {0} }; // end of list
+ROM_SET_CHECK(s_romRegion_Hi_Rst, s_PL_ROM_COUNT);
 
 //Pacland - Japan.
 //
 //
 static const ROM_REGION s_romRegionSetJ[] PROGMEM =     {
-    {NO_BANK_SWITCH,                            s_PL_8B_ROM,       s_PL_ROM_SIZE,          s_romDataJ_PL6_01_8B,        0x4C96E11C, "8B "},
-    {NO_BANK_SWITCH,                            s_PL_8D_ROM,       s_PL_ROM_SIZE,          s_romDataJ_PL6_02_8D,        0x8CF5BD8D, "8D "},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Lo,      0xA9EFA48D, "8E0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Hi,      0x3ABCB7CD, "8E1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Lo,      0x1A11C805, "8F0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Hi,      0x517D4DB8, "8F1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Lo,      0x570B72EA, "8H0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Hi,      0x872C56C0, "8H1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL3_06_8J_Lo,      0xAF660BE5, "8J0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romDataAlt_PL1_06_8J_Hi,   0x567CA359, "8J1"},
+    PL_ROM_8B(s_romDataJ_PL6_01_8B, 0x4C96E11C),
+    PL_ROM_8D(s_romDataJ_PL6_02_8D, 0x8CF5BD8D),
+    PL_BANKED_ROMS_PL1_6,
     {0} }; // end of list
+ROM_SET_CHECK(s_romRegionSetJ, s_PL_ROM_COUNT);
 
 static const ROM_REGION s_romRegionSetJ_Hi[] PROGMEM =     {
-    {NO_BANK_SWITCH,                            s_PL_8B_ROM,       s_PL_ROM_SIZE,          s_romDataJ_PL6_01_8B,        0x99812147, "8B "}, //Hiscore CRC
-    {NO_BANK_SWITCH,                            s_PL_8D_ROM,       s_PL_ROM_SIZE,          s_romDataJ_PL6_02_8D,        0xD15800B4, "8D "}, //Hiscore CRC
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Lo,      0xA9EFA48D, "8E0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Hi,      0x3ABCB7CD, "8E1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Lo,      0x1A11C805, "8F0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Hi,      0x517D4DB8, "8F1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Lo,      0x570B72EA, "8H0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Hi,      0x872C56C0, "8H1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL3_06_8J_Lo,      0xAF660BE5, "8J0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romDataAlt_PL1_06_8J_Hi,   0x567CA359, "8J1"},
+    PL_ROM_8B(s_romDataJ_PL6_01_8B, 0x99812147), //Hiscore CRC
+    PL_ROM_8D(s_romDataJ_PL6_02_8D, 0xD15800B4), //Hiscore CRC
+    PL_BANKED_ROMS_PL1_6,
     {0} }; // end of list
+ROM_SET_CHECK(s_romRegionSetJ_Hi, s_PL_ROM_COUNT);
 
 static const ROM_REGION s_romRegionSetJ_Hi_Rst[] PROGMEM =     {
-    {NO_BANK_SWITCH,                            s_PL_8B_ROM,       s_PL_ROM_SIZE,          s_romDataJ_PL6_01_8B,        0x6644C92A, "8B "}, //Hiscore with reset CRC
-    {NO_BANK_SWITCH,                            s_PL_8D_ROM,       s_PL_ROM_SIZE,          s_romDataJ_PL6_02_8D,        0x7ED251C6, "8D "}, //Hiscore with reset CRC
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Lo,      0xA9EFA48D, "8E0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Hi,      0x3ABCB7CD, "8E1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Lo,      0x1A11C805, "8F0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Hi,      0x517D4DB8, "8F1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Lo,      0x570B72EA, "8H0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Hi,      0x872C56C0, "8H1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL3_06_8J_Lo,      0xAF660BE5, "8J0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romDataAlt_PL1_06_8J_Hi,   0x567CA359, "8J1"},
+    PL_ROM_8B(s_romDataJ_PL6_01_8B, 0x6644C92A), //Hiscore with reset CRC
+    PL_ROM_8D(s_romDataJ_PL6_02_8D, 0x7ED251C6), //Hiscore with reset CRC
+    PL_BANKED_ROMS_PL1_6,
     {0} }; // end of list
+ROM_SET_CHECK(s_romRegionSetJ_Hi_Rst, s_PL_ROM_COUNT);
 
 //Pacland - Japan old and older.
 //
 //
 static const ROM_REGION s_romRegionSetJo[] PROGMEM =     {
-    {NO_BANK_SWITCH,                            s_PL_8B_ROM,       s_PL_ROM_SIZE,          s_romDataJ_PL6_01_8B,        0xF729FB94, "8B "},
-    {NO_BANK_SWITCH,                            s_PL_8D_ROM,       s_PL_ROM_SIZE,          s_romDataJo_PL1_2_8D,        0x5C66EB6F, "8D "},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Lo,      0xA9EFA48D, "8E0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Hi,      0x3ABCB7CD, "8E1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Lo,      0x1A11C805, "8F0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Hi,      0x517D4DB8, "8F1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Lo,      0x570B72EA, "8H0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Hi,      0x872C56C0, "8H1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL3_06_8J_Lo,      0xAF660BE5, "8J0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romDataAlt_PL1_06_8J_Hi,   0x567CA359, "8J1"},
+    PL_ROM_8B(s_romDataJ_PL6_01_8B, 0xF729FB94),
+    PL_ROM_8D(s_romDataJo_PL1_2_8D, 0x5C66EB6F),
+    PL_BANKED_ROMS_PL1_6,
     {0} }; // end of list
+ROM_SET_CHECK(s_romRegionSetJo, s_PL_ROM_COUNT);
 
 static const ROM_REGION s_romRegionSetJo_Hi[] PROGMEM =     {
-    {NO_BANK_SWITCH,                            s_PL_8B_ROM,       s_PL_ROM_SIZE,          s_romDataJ_PL6_01_8B,        0xB2F7DB47, "8B "}, //Hiscore CRC
-    {NO_BANK_SWITCH,                            s_PL_8D_ROM,       s_PL_ROM_SIZE,          s_romDataJo_PL1_2_8D,        0x257E58EC, "8D "}, //Hiscore CRC
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Lo,      0xA9EFA48D, "8E0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Hi,      0x3ABCB7CD, "8E1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Lo,      0x1A11C805, "8F0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Hi,      0x517D4DB8, "8F1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Lo,      0x570B72EA, "8H0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Hi,      0x872C56C0, "8H1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL3_06_8J_Lo,      0xAF660BE5, "8J0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romDataAlt_PL1_06_8J_Hi,   0x567CA359, "8J1"},
+    PL_ROM_8B(s_romDataJ_PL6_01_8B, 0xB2F7DB47), //Hiscore CRC
+    PL_ROM_8D(s_romDataJo_PL1_2_8D, 0x257E58EC), //Hiscore CRC
+    PL_BANKED_ROMS_PL1_6,
     {0} }; // end of list
+ROM_SET_CHECK(s_romRegionSetJo_Hi, s_PL_ROM_COUNT);
 
 static const ROM_REGION s_romRegionSetJo_Hi_Rst[] PROGMEM =     {
-    {NO_BANK_SWITCH,                            s_PL_8B_ROM,       s_PL_ROM_SIZE,          s_romDataJ_PL6_01_8B,        0xB2F7DB47, "8B "}, //Hiscore with reset CRC
-    {NO_BANK_SWITCH,                            s_PL_8D_ROM,       s_PL_ROM_SIZE,          s_romDataJo_PL1_2_8D,        0xD736C6FC, "8D "}, //Hiscore with reset CRC
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Lo,      0xA9EFA48D, "8E0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Hi,      0x3ABCB7CD, "8E1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Lo,      0x1A11C805, "8F0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Hi,      0x517D4DB8, "8F1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Lo,      0x570B72EA, "8H0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Hi,      0x872C56C0, "8H1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL3_06_8J_Lo,      0xAF660BE5, "8J0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romDataAlt_PL1_06_8J_Hi,   0x567CA359, "8J1"},
+    PL_ROM_8B(s_romDataJ_PL6_01_8B, 0xB2F7DB47), //Hiscore with reset CRC
+    PL_ROM_8D(s_romDataJo_PL1_2_8D, 0xD736C6FC), //Hiscore with reset CRC
+    PL_BANKED_ROMS_PL1_6,
     {0} }; // end of list
+ROM_SET_CHECK(s_romRegionSetJo_Hi_Rst, s_PL_ROM_COUNT);
 
 //Pacland - Bally Midway.
 //
 //
 static const ROM_REGION s_romRegionSetM[] PROGMEM =     {
-    {NO_BANK_SWITCH,                            s_PL_8B_ROM,       s_PL_ROM_SIZE,          s_romData_PL5_01B_8B,        0xA938AE99, "8B "},
-    {NO_BANK_SWITCH,                            s_PL_8D_ROM,       s_PL_ROM_SIZE,          s_romDataM_PL1_2,            0x3FE43BB5, "8D "},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Lo,      0xA9EFA48D, "8E0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Hi,      0x3ABCB7CD, "8E1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Lo,      0x1A11C805, "8F0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Hi,      0x517D4DB8, "8F1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Lo,      0x570B72EA, "8H0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Hi,      0x872C56C0, "8H1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL3_06_8J_Lo,      0xAF660BE5, "8J0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romDataAlt_PL1_06_8J_Hi,   0x567CA359, "8J1"},
+    PL_ROM_8B(s_romData_PL5_01B_8B, 0xA938AE99),
+    PL_ROM_8D(s_romDataM_PL1_2,     0x3FE43BB5),
+    PL_BANKED_ROMS_PL1_6,
     {0} }; // end of list
+ROM_SET_CHECK(s_romRegionSetM, s_PL_ROM_COUNT);
 
 static const ROM_REGION s_romRegionSetM_Hi[] PROGMEM =     {
-    {NO_BANK_SWITCH,                            s_PL_8B_ROM,       s_PL_ROM_SIZE,          s_romData_PL5_01B_8B,        0xA938AE99, "8B "},
-    {NO_BANK_SWITCH,                            s_PL_8D_ROM,       s_PL_ROM_SIZE,          s_romDataM_PL1_2,            0x464D170D, "8D "}, //Hiscore CRC
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Lo,      0xA9EFA48D, "8E0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Hi,      0x3ABCB7CD, "8E1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Lo,      0x1A11C805, "8F0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Hi,      0x517D4DB8, "8F1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Lo,      0x570B72EA, "8H0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Hi,      0x872C56C0, "8H1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL3_06_8J_Lo,      0xAF660BE5, "8J0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romDataAlt_PL1_06_8J_Hi,   0x567CA359, "8J1"},
+    PL_ROM_8B(s_romData_PL5_01B_8B, 0xA938AE99),
+    PL_ROM_8D(s_romDataM_PL1_2,     0x464D170D), //Hiscore CRC
+    PL_BANKED_ROMS_PL1_6,
     {0} }; // end of list
+ROM_SET_CHECK(s_romRegionSetM_Hi, s_PL_ROM_COUNT);
 
 static const ROM_REGION s_romRegionSetM_Hi_Rst[] PROGMEM =     {
-    {NO_BANK_SWITCH,                            s_PL_8B_ROM,       s_PL_ROM_SIZE,          s_romData_PL5_01B_8B,        0xA938AE99, "8B "},
-    {NO_BANK_SWITCH,                            s_PL_8D_ROM,       s_PL_ROM_SIZE,          s_romDataM_PL1_2,            0x5F8E80C3, "8D "}, //Hiscore with reset CRC
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Lo,      0xA9EFA48D, "8E0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8E_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_03_8E_Hi,      0x3ABCB7CD, "8E1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Lo,      0x1A11C805, "8F0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8F_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_04_8F_Hi,      0x517D4DB8, "8F1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Lo,      0x570B72EA, "8H0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8H_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL1_05_8H_Hi,      0x872C56C0, "8H1"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Lo, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romData_PL3_06_8J_Lo,      0xAF660BE5, "8J0"},
-    {CPaclandBaseGame::onBankSwitchMPAGE_8J_Hi, s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, s_romDataAlt_PL1_06_8J_Hi,   0x567CA359, "8J1"},
+    PL_ROM_8B(s_romData_PL5_01B_8B, 0xA938AE99),
+    PL_ROM_8D(s_romDataM_PL1_2,     0x5F8E80C3), //Hiscore with reset CRC
+    PL_BANKED_ROMS_PL1_6,
+    {0} }; // end of list
+ROM_SET_CHECK(s_romRegionSetM_Hi_Rst, s_PL_ROM_COUNT);
+
+//Banked ROMs as whole chips - the 2 slices of each are read as one so the CRCs are those of the chip dumps.
+#define PL1_3_8E_CHIP {s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, 2, {CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8E_Lo>, CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8E_Hi>}, 0xAA9FA739, "8E "} // pl1_3.8e
+#define PL1_4_8F_CHIP {s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, 2, {CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8F_Lo>, CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8F_Hi>}, 0x2B895A90, "8F "} // pl1_4.8f
+#define PL1_5_8H_CHIP {s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, 2, {CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8H_Lo>, CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8H_Hi>}, 0x7AF66200, "8H "} // pl1_5.8h
+#define PL3_6_8J_CHIP {s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, 2, {CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8J_Lo>, CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8J_Hi>}, 0x2FFE3319, "8J "} // pl3_6.8j
+#define PL1_6_8J_CHIP {s_MPAGE_ROM_SLICE, s_MPAGE_ROM_SLICE_SIZE, 2, {CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8J_Lo>, CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_8J_Hi>}, 0xB01E59A9, "8J "} // pl1_6.8j
+
+//Namco sets - PL3_6 at 8J
+static const ROM_CHIP s_romChip[] PROGMEM =     {
+    PL1_3_8E_CHIP, PL1_4_8F_CHIP, PL1_5_8H_CHIP, PL3_6_8J_CHIP,
+    {0} }; // end of list
+
+//Japan, Japan Old and Midway sets - PL1_6 at 8J
+static const ROM_CHIP s_romChipJ[] PROGMEM =     {
+    PL1_3_8E_CHIP, PL1_4_8F_CHIP, PL1_5_8H_CHIP, PL1_6_8J_CHIP,
+    {0} }; // end of list
+
+//All the sets above - used to identify the installed set from the 2^n data samples.
+//Jo2 is not listed as its CPU accessible ROMs are the same as Jo.
+//The hiscore mods only differ by CRC so they are reported as '+2' alongside the base set.
+static const ROM_SET s_romSet[] PROGMEM = { //"0123456789"
+    {s_romRegion,                 "Namco     "},
+    {s_romRegion_Hi,              "Namco Hi  "},
+    {s_romRegion_Hi_Rst,          "Namco HiR "},
+    {s_romRegionSetJ,             "Japan     "},
+    {s_romRegionSetJ_Hi,          "Japan Hi  "},
+    {s_romRegionSetJ_Hi_Rst,      "Japan HiR "},
+    {s_romRegionSetJo,            "Japan Old "},
+    {s_romRegionSetJo_Hi,         "JapOld Hi "},
+    {s_romRegionSetJo_Hi_Rst,     "JapOld HiR"},
+    {s_romRegionSetM,             "Midway    "},
+    {s_romRegionSetM_Hi,          "Midway Hi "},
+    {s_romRegionSetM_Hi_Rst,      "Midway HiR"},
     {0} }; // end of list
 
 
@@ -324,7 +302,7 @@ IGame*
 CPaclandGame::createInstance(
 )
 {
-    return (new CPaclandGame(s_romRegion));
+    return (new CPaclandGame(s_romRegion, s_romChip));
 }
 
 // with Hiscore mod
@@ -332,7 +310,7 @@ IGame*
 CPaclandGame::createInstance_Hi(
 )
 {
-    return (new CPaclandGame(s_romRegion_Hi));
+    return (new CPaclandGame(s_romRegion_Hi, s_romChip));
 }
 
 //with Hiscore and Hiscore reset mod
@@ -340,7 +318,7 @@ IGame*
 CPaclandGame::createInstance_Hi_Rst(
 )
 {
-    return (new CPaclandGame(s_romRegion_Hi_Rst));
+    return (new CPaclandGame(s_romRegion_Hi_Rst, s_romChip));
 }
 
 //Japan
@@ -348,21 +326,21 @@ IGame*
 CPaclandGame::createInstance_J(
 )
 {
-    return (new CPaclandGame(s_romRegionSetJ));
+    return (new CPaclandGame(s_romRegionSetJ, s_romChipJ));
 }
 
 IGame*
 CPaclandGame::createInstance_J_Hi(
 )
 {
-    return (new CPaclandGame(s_romRegionSetJ_Hi));
+    return (new CPaclandGame(s_romRegionSetJ_Hi, s_romChipJ));
 }
 
 IGame*
 CPaclandGame::createInstance_J_Hi_Rst(
 )
 {
-    return (new CPaclandGame(s_romRegionSetJ_Hi_Rst));
+    return (new CPaclandGame(s_romRegionSetJ_Hi_Rst, s_romChipJ));
 }
 
 //Japan Old
@@ -370,21 +348,21 @@ IGame*
 CPaclandGame::createInstance_Jo(
 )
 {
-    return (new CPaclandGame(s_romRegionSetJo));
+    return (new CPaclandGame(s_romRegionSetJo, s_romChipJ));
 }
 
 IGame*
 CPaclandGame::createInstance_Jo_Hi(
 )
 {
-    return (new CPaclandGame(s_romRegionSetJo_Hi));
+    return (new CPaclandGame(s_romRegionSetJo_Hi, s_romChipJ));
 }
 
 IGame*
 CPaclandGame::createInstance_Jo_Hi_Rst(
 )
 {
-    return (new CPaclandGame(s_romRegionSetJo_Hi_Rst));
+    return (new CPaclandGame(s_romRegionSetJo_Hi_Rst, s_romChipJ));
 }
 
 //Japan Older
@@ -393,21 +371,21 @@ CPaclandGame::createInstance_Jo2(
 )
 {
     //Currently using same set as Jo as CPU accessible ROMs are same
-    return (new CPaclandGame(s_romRegionSetJo));
+    return (new CPaclandGame(s_romRegionSetJo, s_romChipJ));
 }
 
 IGame*
 CPaclandGame::createInstance_Jo2_Hi(
 )
 {
-    return (new CPaclandGame(s_romRegionSetJo_Hi));
+    return (new CPaclandGame(s_romRegionSetJo_Hi, s_romChipJ));
 }
 
 IGame*
 CPaclandGame::createInstance_Jo2_Hi_Rst(
 )
 {
-    return (new CPaclandGame(s_romRegionSetJo_Hi_Rst));
+    return (new CPaclandGame(s_romRegionSetJo_Hi_Rst, s_romChipJ));
 }
 
 //Bally Midway
@@ -415,27 +393,28 @@ IGame*
 CPaclandGame::createInstance_M(
 )
 {
-    return (new CPaclandGame(s_romRegionSetM));
+    return (new CPaclandGame(s_romRegionSetM, s_romChipJ));
 }
 
 IGame*
 CPaclandGame::createInstance_M_Hi(
 )
 {
-    return (new CPaclandGame(s_romRegionSetM_Hi));
+    return (new CPaclandGame(s_romRegionSetM_Hi, s_romChipJ));
 }
 
 IGame*
 CPaclandGame::createInstance_M_Hi_Rst(
 )
 {
-    return (new CPaclandGame(s_romRegionSetM_Hi_Rst));
+    return (new CPaclandGame(s_romRegionSetM_Hi_Rst, s_romChipJ));
 }
 
 
 CPaclandGame::CPaclandGame(
-const ROM_REGION *romRegion
-) : CPaclandBaseGame( romRegion )
+const ROM_REGION *romRegion,
+const ROM_CHIP   *romChip
+) : CPaclandBaseGame( romRegion, s_romSet, romChip )
 {
 }
 
@@ -26,6 +26,7 @@
 #define CPaclandGame_h
 
 #include "CPaclandBaseGame.h"
+#include "RomSet.h"
 
 class CPaclandGame : public CPaclandBaseGame
 {
@@ -61,7 +62,8 @@ private:
     // Different ROM sets supplied.
     //
     CPaclandGame(
-    const ROM_REGION *romRegion
+    const ROM_REGION *romRegion,
+    const ROM_CHIP   *romChip
     );
     
 };
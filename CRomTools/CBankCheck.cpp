@@ -0,0 +1,461 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "CBankCheck.h"
+
+/*
+
+ A stuck, open or shorted line on a bank register (e.g. Pacland MPAGE at 0x3C00) or a
+ fault in its decode pages the wrong slice into the window, so every banked ROM fails
+ its CRC one after another and looks like a row of bad ROMs.
+
+ The 2^n samples of each banked ROM_REGION are already known, so one sample offset is
+ found at which every bank holds a different byte (or a pair of offsets if no single one
+ will do). Each bank is then selected and that byte read back - one or two bus reads
+ per bank - and the bank it really came from is noted.
+
+ When the window shows other banks the written and seen bank numbers are compared bit by
+ bit, e.g. if bank 3 reads as bank 1 and bank 7 as bank 5, D1 of the register is stuck low.
+
+ A bank that reads as no bank at all is left to the ROM tests - that's more likely to
+ be its ROM than the register.
+
+*/
+
+static const UINT8 c_none = 0xFF;
+
+CBankCheck::CBankCheck(
+    ICpu                     *cpu,
+    void                     *bankSwitchContext,
+    const BANK_SELECT        *bankSelect,
+    const BankSwitchCallback *bankSwitch,
+    UINT8                    bankCount
+) : m_cpu(cpu),
+    m_bankSwitchContext(bankSwitchContext),
+    m_bankSelect(bankSelect),
+    m_bankSwitch(bankSwitch),
+    m_bankCount((bankCount > BANK_CHECK_MAX_BANKS) ? BANK_CHECK_MAX_BANKS : bankCount)
+{
+    m_sample[0] = c_none;
+    m_sample[1] = c_none;
+}
+
+CBankCheck::~CBankCheck(
+)
+{
+}
+
+//
+// Find the region of each bank in the table. Returns the number of banks used.
+//
+UINT8
+CBankCheck::findBanks(
+    const ROM_REGION *romRegion
+)
+{
+    UINT8 found = 0;
+
+    for (UINT8 b = 0 ; b < m_bankCount ; b++)
+    {
+        BankSwitchCallback bankSwitch = (BankSwitchCallback) pgm_read_ptr(&m_bankSwitch[b]);
+
+        m_bank[b].data2n = (const UINT16 *) NULL;
+        m_seen[b] = c_none;
+
+        for (UINT8 r = 0 ; ; r++)
+        {
+            ROM_REGION region;
+
+            memcpy_P(&region, &romRegion[r], sizeof(region));
+
+            if (region.length == 0)
+            {
+                break;
+            }
+
+            if (region.bankSwitch == bankSwitch)
+            {
+                m_bank[b].start   = region.start;
+                m_bank[b].data2n  = region.data2n;
+                m_bank[b].samples = 0;
+
+                for (UINT32 offset = 1 ; offset < region.length ; offset <<= 1)
+                {
+                    m_bank[b].samples++;
+                }
+
+                found++;
+                break;
+            }
+        }
+    }
+
+    return found;
+}
+
+//
+// True if no two banks hold the same data at the sample(s).
+//
+bool
+CBankCheck::distinct(
+    UINT8 first,
+    UINT8 second
+)
+{
+    for (UINT8 b = 0 ; b < m_bankCount ; b++)
+    {
+        if (m_bank[b].data2n == NULL)
+        {
+            continue;
+        }
+
+        for (UINT8 c = b + 1 ; c < m_bankCount ; c++)
+        {
+            if (m_bank[c].data2n == NULL)
+            {
+                continue;
+            }
+
+            if ((m_bank[b].data2n[first] == m_bank[c].data2n[first]) &&
+                ((second == c_none) || (m_bank[b].data2n[second] == m_bank[c].data2n[second])))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+//
+// Pick the sample offset (or pair of offsets) that tells every bank apart.
+//
+bool
+CBankCheck::chooseSamples(
+)
+{
+    UINT8 samples = c_none;
+
+    for (UINT8 b = 0 ; b < m_bankCount ; b++)
+    {
+        if ((m_bank[b].data2n != NULL) && (m_bank[b].samples < samples))
+        {
+            samples = m_bank[b].samples;
+        }
+    }
+
+    for (UINT8 i = 0 ; i < samples ; i++)
+    {
+        if (distinct(i, c_none))
+        {
+            m_sample[0] = i;
+            return true;
+        }
+    }
+
+    for (UINT8 i = 0 ; i < samples ; i++)
+    {
+        for (UINT8 j = i + 1 ; j < samples ; j++)
+        {
+            if (distinct(i, j))
+            {
+                m_sample[0] = i;
+                m_sample[1] = j;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+bool
+CBankCheck::matches(
+    UINT8  bank,
+    UINT16 *data
+)
+{
+    if (m_bank[bank].data2n == NULL)
+    {
+        return false;
+    }
+
+    return (data[0] == m_bank[bank].data2n[m_sample[0]]) &&
+           ((m_sample[1] == c_none) || (data[1] == m_bank[bank].data2n[m_sample[1]]));
+}
+
+//
+// Select each bank and note which bank the window really shows.
+//
+PERROR
+CBankCheck::readBanks(
+)
+{
+    PERROR error = errorSuccess;
+
+    for (UINT8 b = 0 ; b < m_bankCount ; b++)
+    {
+        BankSwitchCallback bankSwitch = (BankSwitchCallback) pgm_read_ptr(&m_bankSwitch[b]);
+        UINT16 data[2] = {0, 0};
+
+        if (m_bank[b].data2n == NULL)
+        {
+            continue;
+        }
+
+        error = bankSwitch(m_bankSwitchContext);
+        if (FAILED(error))
+        {
+            return error;
+        }
+
+        for (UINT8 s = 0 ; (s < 2) && (m_sample[s] != c_none) ; s++)
+        {
+            error = m_cpu->memoryRead(m_bank[b].start + (1UL << m_sample[s]), &data[s]);
+            if (FAILED(error))
+            {
+                return error;
+            }
+        }
+
+        if (matches(b, data))
+        {
+            m_seen[b] = b;
+            continue;
+        }
+
+        for (UINT8 c = 0 ; c < m_bankCount ; c++)
+        {
+            if (matches(c, data))
+            {
+                m_seen[b] = c;
+                break;
+            }
+        }
+    }
+
+    return error;
+}
+
+//
+// The window showed the wrong bank. Report a register line stuck at one level, two lines
+// shorted together or, failing those, the first bank that read as another.
+//
+// E:3c00 D1 lo    - D1 always seen low.
+// E:3c00 D0=D2    - D0 and D2 always seen equal.
+// E:3c00 B3=B5    - bank 3 shows bank 5.
+//
+PERROR
+CBankCheck::reportLatchFault(
+)
+{
+    PERROR error = errorCustom;
+    UINT16 written[BANK_CHECK_MAX_BANKS];
+    UINT16 seen[BANK_CHECK_MAX_BANKS];
+    UINT16 lines = 0;
+    UINT16 writtenAnd = 0xFFFF;
+    UINT16 seenOr = 0;
+    UINT16 seenAnd = 0xFFFF;
+    UINT8  count = 0;
+    UINT8  first = c_none;
+
+    for (UINT8 b = 0 ; b < m_bankCount ; b++)
+    {
+        if (m_seen[b] == c_none)
+        {
+            continue;
+        }
+
+        if ((m_seen[b] != b) && (first == c_none))
+        {
+            first = b;
+        }
+
+        written[count] = pgm_read_word(&m_bankSelect[b].value);
+        seen[count]    = pgm_read_word(&m_bankSelect[m_seen[b]].value);
+        lines |= written[count];
+        count++;
+    }
+
+    error->code = ERROR_FAILED;
+    error->description = "E:";
+    STRING_UINT16_HEX(error->description, pgm_read_dword(&m_bankSelect[first].address));
+
+    for (UINT8 i = 0 ; i < count ; i++)
+    {
+        writtenAnd &= written[i];
+        seenOr     |= seen[i];
+        seenAnd    &= seen[i];
+    }
+
+    for (UINT8 line = 0 ; line < 16 ; line++)
+    {
+        UINT16 bit = (1 << line);
+
+        if (!(lines & bit))
+        {
+            continue;
+        }
+
+        if (!(seenOr & bit) || ((seenAnd & bit) && !(writtenAnd & bit)))
+        {
+            error->description += " D";
+            error->description += String(line, DEC);
+            error->description += (seenAnd & bit) ? " hi" : " lo";
+            return error;
+        }
+    }
+
+    for (UINT8 line = 0 ; line < 16 ; line++)
+    {
+        for (UINT8 other = line + 1 ; other < 16 ; other++)
+        {
+            bool differs = false;
+            bool shorted = true;
+
+            if (!(lines & (1 << line)) || !(lines & (1 << other)))
+            {
+                continue;
+            }
+
+            for (UINT8 i = 0 ; i < count ; i++)
+            {
+                differs |= (((written[i] >> line) ^ (written[i] >> other)) & 1) != 0;
+                shorted &= (((seen[i] >> line) ^ (seen[i] >> other)) & 1) == 0;
+            }
+
+            if (differs && shorted)
+            {
+                error->description += " D";
+                error->description += String(line, DEC);
+                error->description += "=D";
+                error->description += String(other, DEC);
+                return error;
+            }
+        }
+    }
+
+    error->description += " B";
+    error->description += String(first, DEC);
+    error->description += "=B";
+    error->description += String(m_seen[first], DEC);
+
+    return error;
+}
+
+//
+// OK: n banks     - every bank read back as itself.
+// OK: no banks    - the table has no banked regions.
+// E:banks untested - fewer than 2 banks in the table, or no samples tell them apart.
+// E:3c00 B3 ? +n  - bank 3 (and n others) read as no known bank - left to the ROM tests.
+// E:3c00 ...      - the wrong bank was seen, see reportLatchFault.
+//
+PERROR
+CBankCheck::check(
+    const ROM_REGION *romRegion,
+    bool             *latchFault
+)
+{
+    PERROR error = errorSuccess;
+    UINT8 checked = 0;
+    UINT8 unknown = 0;
+    UINT8 first = c_none;
+    UINT8 found;
+
+    *latchFault = false;
+
+    found = findBanks(romRegion);
+
+    if (found == 0)
+    {
+        error = errorCustom;
+        error->code = ERROR_SUCCESS;
+        error->description = "OK: no banks";
+        return error;
+    }
+
+    if ((found < 2) || !chooseSamples())
+    {
+        error = errorCustom;
+        error->code = ERROR_FAILED;
+        error->description = "E:banks untested";
+        return error;
+    }
+
+    error = readBanks();
+    if (FAILED(error))
+    {
+        return error;
+    }
+
+    for (UINT8 b = 0 ; b < m_bankCount ; b++)
+    {
+        if (m_bank[b].data2n == NULL)
+        {
+            continue;
+        }
+
+        checked++;
+
+        if ((m_seen[b] != c_none) && (m_seen[b] != b))
+        {
+            *latchFault = true;
+            return reportLatchFault();
+        }
+
+        if (m_seen[b] == c_none)
+        {
+            if (unknown++ == 0)
+            {
+                first = b;
+            }
+        }
+    }
+
+    error = errorCustom;
+
+    if (unknown == 0)
+    {
+        error->code = ERROR_SUCCESS;
+        error->description = "OK: ";
+        error->description += String(checked, DEC);
+        error->description += " banks";
+    }
+    else
+    {
+        error->code = ERROR_FAILED;
+        error->description = "E:";
+        STRING_UINT16_HEX(error->description, pgm_read_dword(&m_bankSelect[first].address));
+        error->description += " B";
+        error->description += String(first, DEC);
+        error->description += " ?";
+
+        if (unknown > 1)
+        {
+            error->description += " +";
+            error->description += String(unknown - 1, DEC);
+        }
+    }
+
+    return error;
+}
@@ -0,0 +1,110 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef CBankCheck_h
+#define CBankCheck_h
+
+#include "ICpu.h"
+#include "CRomSchedule.h"
+
+//
+// Maximum number of banks behind one bank register.
+//
+#define BANK_CHECK_MAX_BANKS 16
+
+//
+// Checks a bank register by selecting each bank in turn and reading back a byte
+// from the window that only that bank holds, before any of the long banked ROM tests.
+//
+class CBankCheck
+{
+    public:
+
+        //
+        // bankSelect and bankSwitch are PROGMEM tables of bankCount entries, both
+        // indexed by the game's bank number.
+        //
+        CBankCheck(
+                   ICpu                     *cpu,
+                   void                     *bankSwitchContext,
+                   const BANK_SELECT        *bankSelect,
+                   const BankSwitchCallback *bankSwitch,
+                   UINT8                    bankCount
+        );
+
+        ~CBankCheck(
+        );
+
+        //
+        // Check the register against the samples of the banked ROMs in the PROGMEM table.
+        // latchFault is set when the window showed the wrong bank - the register or its
+        // decode is at fault and the banked ROM tests can't give a useful result.
+        //
+        PERROR check(
+                     const ROM_REGION *romRegion,
+                     bool             *latchFault
+        );
+
+    private:
+
+        typedef struct _BANK {
+            UINT32       start;
+            const UINT16 *data2n;
+            UINT8        samples;
+        } BANK;
+
+        UINT8 findBanks(
+                        const ROM_REGION *romRegion
+        );
+
+        bool chooseSamples(
+        );
+
+        bool distinct(
+                      UINT8 first,
+                      UINT8 second
+        );
+
+        bool matches(
+                     UINT8  bank,
+                     UINT16 *data
+        );
+
+        PERROR readBanks(
+        );
+
+        PERROR reportLatchFault(
+        );
+
+        ICpu                     *m_cpu;
+        void                     *m_bankSwitchContext;
+        const BANK_SELECT        *m_bankSelect;
+        const BankSwitchCallback *m_bankSwitch;
+        UINT8                    m_bankCount;
+
+        BANK                     m_bank[BANK_CHECK_MAX_BANKS];
+        UINT8                    m_seen[BANK_CHECK_MAX_BANKS];
+        UINT8                    m_sample[2];
+};
+
+#endif
@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef CCrc32_h
+#define CCrc32_h
+
+#include "Types.h"
+#include "Error.h"
+
+//
+// CRC32 kernels. The table kernel is fastest but costs 1KB of PROGMEM,
+// the nibble kernel needs 64 bytes and the bitwise kernel none.
+//
+#define CRC32_KERNEL_BITWISE 0
+#define CRC32_KERNEL_NIBBLE  1
+#define CRC32_KERNEL_TABLE   2
+
+#ifndef CRC32_KERNEL
+#define CRC32_KERNEL CRC32_KERNEL_TABLE
+#endif
+
+//
+// CRC32 (IEEE 802.3, reflected, polynomial 0xEDB88320) as used by MAME and zip.
+//
+// crc = CCrc32::c_init;
+// crc = CCrc32::update(crc, data);   // for each byte
+// crc = CCrc32::final(crc);
+//
+class CCrc32
+{
+    public:
+
+        static const UINT32 c_init = 0xFFFFFFFF;
+
+        // Update with the CRC32_KERNEL selected at build time.
+        static UINT32 update(
+                             UINT32 crc,
+                             UINT8  data
+        );
+
+        static UINT32 updateBitwise(
+                                    UINT32 crc,
+                                    UINT8  data
+        );
+
+        static UINT32 updateNibble(
+                                   UINT32 crc,
+                                   UINT8  data
+        );
+
+        static UINT32 updateTable(
+                                  UINT32 crc,
+                                  UINT8  data
+        );
+
+        static UINT32 final(
+                            UINT32 crc
+        );
+
+        //
+        // Find the one bit whose flip turns a length byte image with CRC expected
+        // into one with CRC actual. Returns false if it isn't a single bit error.
+        //
+        static bool findBitError(
+                                 UINT32 expected,
+                                 UINT32 actual,
+                                 UINT32 length,
+                                 UINT32 *offset,
+                                 UINT8  *bit
+        );
+
+        //
+        // Custom function - reports the cycles per byte of each kernel.
+        //
+        static PERROR benchmark(
+                                void *context
+        );
+};
+
+#endif
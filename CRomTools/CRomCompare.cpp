@@ -0,0 +1,416 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "CRomCompare.h"
+#include "CCrc32.h"
+
+/*
+
+ Compare a ROM with a reference image that only the PC has - a hack, bootleg or prototype
+ with no entry in the game's table. The image is never stored on the Mega: it arrives in
+ step with the bus reads, as a consumer of a CRomStream, so each byte read is compared
+ with the image byte of the same offset and then dropped. A compare takes about as long
+ as one read of the ROM.
+
+ The Mega's UART only buffers 64 bytes so the ICT asks for the image a chunk at a time,
+ keeping ROM_COMPARE_CHUNKS_AHEAD chunks requested so the PC's next bytes are on the way
+ while the current ones are compared. The chunks aren't framed; the image CRC32 sent up
+ front is checked against the bytes received instead, so a corrupt link shows as a link
+ error rather than as mismatches.
+
+*/
+
+CRomCompare::CRomCompare(
+    ICpu *cpu,
+    void *bankSwitchContext
+) : m_cpu(cpu),
+    m_bankSwitchContext(bankSwitchContext),
+    m_length(0),
+    m_requested(0),
+    m_received(0),
+    m_imageCrc(CCrc32::c_init),
+    m_romCrc(CCrc32::c_init),
+    m_timedOut(false),
+    m_mismatchCount(0)
+{
+}
+
+CRomCompare::~CRomCompare(
+)
+{
+}
+
+UINT32
+CRomCompare::getUINT32(
+    const UINT8 *data
+)
+{
+    return ((UINT32) data[0] <<  0) |
+           ((UINT32) data[1] <<  8) |
+           ((UINT32) data[2] << 16) |
+           ((UINT32) data[3] << 24);
+}
+
+//
+// "8D" matches the region "8D " and the slices "8E0", "8E1" of "8E".
+//
+bool
+CRomCompare::matchLocation(
+    const char *regionLocation,
+    const char *location
+)
+{
+    UINT8 i;
+
+    for (i = 0 ; (i < 3) && (location[i] != ' ') && (location[i] != 0) ; i++)
+    {
+        if (regionLocation[i] != location[i])
+        {
+            return false;
+        }
+    }
+
+    return (i > 0) &&
+           ((i == 3) ||
+            (regionLocation[i] == ' ') ||
+            (regionLocation[i] == 0) ||
+            ((regionLocation[i] >= '0') && (regionLocation[i] <= '9')));
+}
+
+UINT32
+CRomCompare::socketLength(
+    const ROM_REGION *romRegion,
+    const char       *location
+)
+{
+    UINT32 length = 0;
+
+    for (UINT8 r = 0 ; ; r++)
+    {
+        ROM_REGION region;
+
+        memcpy_P(&region, &romRegion[r], sizeof(region));
+
+        if (region.length == 0)
+        {
+            break;
+        }
+
+        if (matchLocation(region.location, location))
+        {
+            length += region.length;
+        }
+    }
+
+    return length;
+}
+
+PERROR
+CRomCompare::readSocket(
+    const ROM_REGION *romRegion,
+    const char       *location,
+    CRomStream       *stream
+)
+{
+    PERROR error = errorSuccess;
+
+    for (UINT8 r = 0 ; !stream->stopped() ; r++)
+    {
+        ROM_REGION region;
+
+        memcpy_P(&region, &romRegion[r], sizeof(region));
+
+        if (region.length == 0)
+        {
+            break;
+        }
+
+        if (!matchLocation(region.location, location))
+        {
+            continue;
+        }
+
+        if (region.bankSwitch != NO_BANK_SWITCH)
+        {
+            error = region.bankSwitch(m_bankSwitchContext);
+            if (FAILED(error))
+            {
+                break;
+            }
+        }
+
+        error = stream->read(region.start, region.length);
+        if (FAILED(error))
+        {
+            break;
+        }
+    }
+
+    return error;
+}
+
+void
+CRomCompare::request(
+)
+{
+    while ((m_requested < m_length) &&
+           (m_requested - m_received < ROM_COMPARE_CHUNK_SIZE * ROM_COMPARE_CHUNKS_AHEAD))
+    {
+        Serial.write((UINT8) ROM_COMPARE_NEXT);
+
+        m_requested += ((m_length - m_requested) < ROM_COMPARE_CHUNK_SIZE) ?
+                       (m_length - m_requested) : ROM_COMPARE_CHUNK_SIZE;
+    }
+}
+
+void
+CRomCompare::sendStart(
+    UINT32 length
+)
+{
+    m_frame.begin(ROM_COMPARE_START, 4);
+    m_frame.writeUINT32(length);
+    m_frame.end();
+}
+
+void
+CRomCompare::sendMismatches(
+    bool linkGood
+)
+{
+    UINT8 kept = (m_mismatchCount < ROM_COMPARE_MAX_MISMATCHES) ?
+                 (UINT8) m_mismatchCount : ROM_COMPARE_MAX_MISMATCHES;
+
+    m_frame.begin(ROM_COMPARE_MISMATCHES, 4 + 4 + 1 + (kept * (4 + 1 + 1)));
+    m_frame.writeUINT32(m_mismatchCount);
+    m_frame.writeUINT32(CCrc32::final(m_romCrc));
+    m_frame.write(linkGood ? 1 : 0);
+
+    for (UINT8 i = 0 ; i < kept ; i++)
+    {
+        m_frame.writeUINT32(m_mismatch[i].offset);
+        m_frame.write(m_mismatch[i].expected);
+        m_frame.write(m_mismatch[i].actual);
+    }
+
+    m_frame.end();
+}
+
+void
+CRomCompare::begin(
+    UINT32 length
+)
+{
+    m_length = length;
+    m_requested = 0;
+    m_received = 0;
+    m_imageCrc = CCrc32::c_init;
+    m_romCrc = CCrc32::c_init;
+    m_timedOut = false;
+    m_mismatchCount = 0;
+
+    request();
+}
+
+bool
+CRomCompare::consume(
+    UINT32      offset,
+    const UINT8 *data,
+    UINT16      length
+)
+{
+    for (UINT16 i = 0 ; i < length ; i++, offset++)
+    {
+        UINT8 expected;
+
+        if (!CRomFrame::read(&expected, ROM_COMPARE_TIMEOUT_MS))
+        {
+            m_timedOut = true;
+            return false;
+        }
+
+        m_received++;
+        request();
+
+        m_imageCrc = CCrc32::update(m_imageCrc, expected);
+        m_romCrc = CCrc32::update(m_romCrc, data[i]);
+
+        if (data[i] != expected)
+        {
+            if (m_mismatchCount < ROM_COMPARE_MAX_MISMATCHES)
+            {
+                m_mismatch[m_mismatchCount].offset = offset;
+                m_mismatch[m_mismatchCount].expected = expected;
+                m_mismatch[m_mismatchCount].actual = data[i];
+            }
+
+            m_mismatchCount++;
+        }
+    }
+
+    return true;
+}
+
+void
+CRomCompare::end(
+)
+{
+}
+
+//
+// OK: 4096 same       - every byte matched.
+// E:37 +0123 +04A6    - 37 bytes differ, the first at image offsets 0x123 and 0x4A6.
+// E:No image          - the PC sent nothing.
+// E:8D 2048 not 4096  - the image isn't the size of the socket.
+// E:8Q no socket      - no ROM of the game's table is at that location.
+// E:Link              - the image bytes failed their CRC or stopped coming.
+//
+PERROR
+CRomCompare::compare(
+    const ROM_REGION *romRegion
+)
+{
+    PERROR error = errorSuccess;
+    CRomStream stream(m_cpu);
+    UINT8 header[4 + 4 + 4 + 4];
+    UINT16 headerLength;
+    UINT8 type;
+    char location[4];
+    UINT32 start;
+    UINT32 length;
+    UINT32 socket = 0;
+    bool serialWasActive;
+    bool linkGood;
+
+    stream.add(this);
+
+    serialWasActive = CRomFrame::open();
+
+    m_frame.begin(ROM_COMPARE_WAITING, 0);
+    m_frame.end();
+
+    if (!m_frame.receive(&type, header, sizeof(header), &headerLength, ROM_COMPARE_WAIT_MS) ||
+        (type != ROM_COMPARE_IMAGE) ||
+        (headerLength != sizeof(header)))
+    {
+        CRomFrame::close(serialWasActive);
+
+        error = errorCustom;
+        error->code = ERROR_FAILED;
+        error->description = "E:No image";
+        return error;
+    }
+
+    memcpy(location, &header[0], sizeof(location));
+    location[3] = 0;
+    start = getUINT32(&header[4]);
+    length = getUINT32(&header[8]);
+
+    if ((location[0] != ' ') && (location[0] != 0))
+    {
+        socket = socketLength(romRegion, location);
+
+        if ((socket == 0) || (socket != length))
+        {
+            sendStart(0);
+            CRomFrame::close(serialWasActive);
+
+            error = errorCustom;
+            error->code = ERROR_FAILED;
+            error->description = "E:";
+            error->description += location;
+
+            if (socket == 0)
+            {
+                error->description += " no socket";
+            }
+            else
+            {
+                error->description += " ";
+                error->description += String(length, DEC);
+                error->description += " not ";
+                error->description += String(socket, DEC);
+            }
+
+            return error;
+        }
+    }
+
+    sendStart(length);
+
+    stream.begin(length);
+
+    if (socket != 0)
+    {
+        error = readSocket(romRegion, location, &stream);
+    }
+    else
+    {
+        error = stream.read(start, length);
+    }
+
+    stream.end();
+
+    linkGood = !m_timedOut && (CCrc32::final(m_imageCrc) == getUINT32(&header[12]));
+
+    if (SUCCESS(error) && !m_timedOut)
+    {
+        sendMismatches(linkGood);
+    }
+
+    CRomFrame::close(serialWasActive);
+
+    if (FAILED(error))
+    {
+        return error;
+    }
+
+    error = errorCustom;
+
+    if (!linkGood)
+    {
+        error->code = ERROR_FAILED;
+        error->description = "E:Link";
+    }
+    else if (m_mismatchCount == 0)
+    {
+        error->code = ERROR_SUCCESS;
+        error->description = "OK: ";
+        error->description += String(length, DEC);
+        error->description += " same";
+    }
+    else
+    {
+        error->code = ERROR_FAILED;
+        error->description = "E:";
+        error->description += String(m_mismatchCount, DEC);
+
+        for (UINT8 i = 0 ; (i < 2) && (i < m_mismatchCount) ; i++)
+        {
+            error->description += " +";
+            STRING_UINT16_HEX(error->description, (UINT16) m_mismatch[i].offset);
+        }
+    }
+
+    return error;
+}
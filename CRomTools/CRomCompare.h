@@ -0,0 +1,164 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef CRomCompare_h
+#define CRomCompare_h
+
+#include "ICpu.h"
+#include "CRomStream.h"
+#include "CRomFrame.h"
+
+//
+// Image bytes the PC sends for each request. Two chunks are kept in flight, well inside
+// the 64 byte receive buffer of the Mega's UART.
+//
+#define ROM_COMPARE_CHUNK_SIZE 16
+#define ROM_COMPARE_CHUNKS_AHEAD 2
+
+//
+// Mismatches kept for the result frame - the count covers all of them.
+//
+#define ROM_COMPARE_MAX_MISMATCHES 16
+
+//
+// ms to wait for the PC to send the image header, and for each byte after that.
+//
+#define ROM_COMPARE_WAIT_MS    30000
+#define ROM_COMPARE_TIMEOUT_MS 1000
+
+//
+// CRomFrame frames of the types
+//
+//   'W' waiting      - no payload, the ICT is ready for the image
+//   'I' image (PC)   - location (4), start (UINT32), length (UINT32), CRC32 of the image (UINT32)
+//   'S' start        - length to be sent (UINT32), 0 if the image was refused
+//   'M' mismatches   - count (UINT32), CRC32 of the ROM as read (UINT32), image CRC32
+//                      good (UINT8), then for each kept mismatch offset (UINT32),
+//                      image byte, ROM byte
+//
+// Between 'S' and 'M' the ICT sends a single 'N' byte for each ROM_COMPARE_CHUNK_SIZE
+// bytes of the image it wants next and the PC answers with just those bytes; the image
+// CRC32 of the 'I' frame checks them at the end. A location names a socket of the
+// game's table (its bank slices are read in table order, e.g. "8E" for 8E0 then 8E1);
+// a blank location compares start to start + length with no bank switch.
+//
+// Sent by extras/rom_compare_send.py.
+//
+#define ROM_COMPARE_WAITING     'W'
+#define ROM_COMPARE_IMAGE       'I'
+#define ROM_COMPARE_START       'S'
+#define ROM_COMPARE_MISMATCHES  'M'
+#define ROM_COMPARE_NEXT        'N'
+
+typedef struct _ROM_MISMATCH {
+    UINT32 offset;    // In the image
+    UINT8  expected;  // Image byte
+    UINT8  actual;    // ROM byte
+} ROM_MISMATCH;
+
+class CRomCompare : public IRomConsumer
+{
+    public:
+
+        CRomCompare(
+                    ICpu *cpu,
+                    void *bankSwitchContext
+        );
+
+        ~CRomCompare(
+        );
+
+        //
+        // Compare a ROM with an image streamed from the PC as it's read, for ROMs that
+        // have no entry in the table. romRegion is the game's PROGMEM table, used to
+        // find the socket named by the PC.
+        //
+        PERROR compare(
+                       const ROM_REGION *romRegion
+        );
+
+        //
+        // IRomConsumer - compares each byte read with the next byte of the image.
+        //
+        void begin(
+                   UINT32 length
+        );
+
+        bool consume(
+                     UINT32      offset,
+                     const UINT8 *data,
+                     UINT16      length
+        );
+
+        void end(
+        );
+
+    private:
+
+        static bool matchLocation(
+                                  const char *regionLocation,
+                                  const char *location
+        );
+
+        static UINT32 getUINT32(
+                                const UINT8 *data
+        );
+
+        UINT32 socketLength(
+                            const ROM_REGION *romRegion,
+                            const char       *location
+        );
+
+        PERROR readSocket(
+                          const ROM_REGION *romRegion,
+                          const char       *location,
+                          CRomStream       *stream
+        );
+
+        void request(
+        );
+
+        void sendStart(
+                       UINT32 length
+        );
+
+        void sendMismatches(
+                            bool linkGood
+        );
+
+        ICpu         *m_cpu;
+        void         *m_bankSwitchContext;
+        CRomFrame    m_frame;
+
+        UINT32       m_length;
+        UINT32       m_requested;
+        UINT32       m_received;
+        UINT32       m_imageCrc;
+        UINT32       m_romCrc;
+        bool         m_timedOut;
+
+        UINT32       m_mismatchCount;
+        ROM_MISMATCH m_mismatch[ROM_COMPARE_MAX_MISMATCHES];
+};
+
+#endif
@@ -0,0 +1,213 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "CRomDump.h"
+
+/*
+
+ Stream every ROM of a game off the board as framed binary - see CRomDump.h for the format.
+
+ The dump is a consumer of a CRomStream. Each buffer of bytes is queued to the UART as
+ soon as it's read so the interrupt driven transmit drains it while the next buffer is
+ read from the bus; at 1M baud a byte goes in 10us, well inside a bus read, so the dump
+ runs at the speed of the bus reads (a 16KB ROM in a second or two) rather than waiting
+ on the port. A CRomVerify shares the pass so bad ROMs are counted without a second read.
+
+ Each frame carries its own CRC32 (see CRomFrame) so the receiver can report a corrupt
+ frame rather than save a bad image. The ROM frame carries the CRC32 from the table so
+ the receiver can also check the whole image.
+
+ Banked ROMs are sent slice by slice in the bank order of CRomSchedule, each slice as its
+ own ROM numbered in the order sent.
+
+*/
+
+CRomDump::CRomDump(
+    ICpu *cpu,
+    void *bankSwitchContext
+) : m_cpu(cpu),
+    m_bankSwitchContext(bankSwitchContext),
+    m_length(0)
+{
+}
+
+CRomDump::~CRomDump(
+)
+{
+}
+
+void
+CRomDump::sendRom(
+    const ROM_REGION *region,
+    UINT8            index
+)
+{
+    m_frame.begin(ROM_DUMP_ROM, 1 + 4 + 4 + 4 + sizeof(region->location));
+    m_frame.write(index);
+    m_frame.writeUINT32(region->start);
+    m_frame.writeUINT32(region->length);
+    m_frame.writeUINT32(region->crc);
+
+    for (UINT8 i = 0 ; i < sizeof(region->location) ; i++)
+    {
+        m_frame.write((UINT8) region->location[i]);
+    }
+
+    m_frame.end();
+}
+
+void
+CRomDump::begin(
+    UINT32 length
+)
+{
+    m_length = length;
+}
+
+//
+// Data frames start every ROM_DUMP_FRAME_SIZE bytes, whatever the size of the buffers.
+// A failed read mid frame leaves the frame short; the receiver drops it on the CRC.
+//
+bool
+CRomDump::consume(
+    UINT32      offset,
+    const UINT8 *data,
+    UINT16      length
+)
+{
+    for (UINT16 i = 0 ; i < length ; i++, offset++)
+    {
+        if (offset % ROM_DUMP_FRAME_SIZE == 0)
+        {
+            UINT16 size = ((m_length - offset) < ROM_DUMP_FRAME_SIZE) ?
+                          (UINT16) (m_length - offset) : ROM_DUMP_FRAME_SIZE;
+
+            m_frame.begin(ROM_DUMP_DATA, 4 + size);
+            m_frame.writeUINT32(offset);
+        }
+
+        m_frame.write(data[i]);
+
+        if (((offset + 1) % ROM_DUMP_FRAME_SIZE == 0) || (offset + 1 == m_length))
+        {
+            m_frame.end();
+        }
+    }
+
+    return true;
+}
+
+void
+CRomDump::end(
+)
+{
+}
+
+//
+// OK: n ROMs ts    - every ROM sent in t seconds.
+// E: n ROMs b bad  - every ROM sent but b failed their CRC.
+//
+PERROR
+CRomDump::dump(
+    const ROM_REGION *romRegion
+)
+{
+    PERROR error = errorSuccess;
+    CRomSchedule schedule(romRegion, m_bankSwitchContext);
+    CRomVerify romVerify(m_cpu, m_bankSwitchContext);
+    CRomStream stream(m_cpu);
+    ROM_REGION region;
+    bool serialWasActive;
+    UINT32 startTime;
+    UINT8 count = 0;
+    UINT8 bad = 0;
+
+    error = schedule.check();
+    if (FAILED(error))
+    {
+        return error;
+    }
+
+    stream.add(this);
+    stream.add(&romVerify);
+
+    // The dump needs the port at its own rate - 9600 baud is put back if it was in use.
+    serialWasActive = CRomFrame::open();
+
+    startTime = millis();
+
+    while (schedule.next(&region))
+    {
+        error = schedule.select(&region);
+        if (FAILED(error))
+        {
+            break;
+        }
+
+        sendRom(&region, count);
+
+        error = stream.read(&region);
+        if (FAILED(error))
+        {
+            break;
+        }
+
+        if (romVerify.crc() != region.crc)
+        {
+            bad++;
+        }
+
+        count++;
+    }
+
+    if (SUCCESS(error))
+    {
+        m_frame.begin(ROM_DUMP_END, 1);
+        m_frame.write(count);
+        m_frame.end();
+    }
+
+    CRomFrame::close(serialWasActive);
+
+    if (SUCCESS(error))
+    {
+        error = errorCustom;
+        error->code = (bad == 0) ? ERROR_SUCCESS : ERROR_FAILED;
+        error->description = (bad == 0) ? "OK: " : "E: ";
+        error->description += String(count, DEC);
+        error->description += " ROMs ";
+
+        if (bad == 0)
+        {
+            error->description += String((millis() - startTime + 500) / 1000, DEC);
+            error->description += "s";
+        }
+        else
+        {
+            error->description += String(bad, DEC);
+            error->description += " bad";
+        }
+    }
+
+    return error;
+}
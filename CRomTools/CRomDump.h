@@ -0,0 +1,100 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef CRomDump_h
+#define CRomDump_h
+
+#include "ICpu.h"
+#include "CRomSchedule.h"
+#include "CCrc32.h"
+#include "CRomVerify.h"
+#include "CRomFrame.h"
+
+//
+// Data bytes per frame.
+//
+#define ROM_DUMP_FRAME_SIZE 256
+
+//
+// CRomFrame frames of the types
+//
+//   'R' ROM    - index (UINT8), start (UINT32), length (UINT32), CRC32 (UINT32), location (4)
+//   'D' data   - offset in the ROM (UINT32), then up to ROM_DUMP_FRAME_SIZE bytes
+//   'E' end    - number of ROMs sent (UINT8)
+//
+// received by extras/rom_dump_receive.py.
+//
+#define ROM_DUMP_ROM   'R'
+#define ROM_DUMP_DATA  'D'
+#define ROM_DUMP_END   'E'
+
+class CRomDump : public IRomConsumer
+{
+    public:
+
+        CRomDump(
+                 ICpu *cpu,
+                 void *bankSwitchContext
+        );
+
+        ~CRomDump(
+        );
+
+        //
+        // Send every ROM in the PROGMEM table, banked ROMs included, checking the
+        // CRC of each in the same pass.
+        //
+        PERROR dump(
+                    const ROM_REGION *romRegion
+        );
+
+        //
+        // IRomConsumer - sends the bytes of a pass as data frames.
+        //
+        void begin(
+                   UINT32 length
+        );
+
+        bool consume(
+                     UINT32      offset,
+                     const UINT8 *data,
+                     UINT16      length
+        );
+
+        void end(
+        );
+
+    private:
+
+        void sendRom(
+                     const ROM_REGION *region,
+                     UINT8            index
+        );
+
+        ICpu      *m_cpu;
+        void      *m_bankSwitchContext;
+        CRomFrame m_frame;
+        UINT32    m_length;
+};
+
+#endif
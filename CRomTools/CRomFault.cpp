@@ -0,0 +1,387 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#include "CRomFault.h"
+
+/*
+
+ Classify a ROM that failed its CRC, in order:
+
+ - every byte the same   - empty socket (0xFF), missing part or a dead /CE or /OE.
+ - unstable reads        - floating data bus.
+ - a data bit stuck      - never 0 (or never 1) in the pass but the 2^n samples
+                           show it should change.
+ - an aliased address    - the 2^n sample for the line is wrong and 8 pairs of
+   line                    addresses differing only in that line read the same.
+                           When it's the top line the part is likely half the size
+                           of the socket.
+ - most 2^n samples bad  - wrong part or revision.
+ - otherwise             - corrupt data in a working part.
+
+ At most 8 + 16 * 16 reads are made on top of the pass.
+
+ probeSize uses the same alias test before the pass, working down from the top line of
+ the socket, to find a smaller part (e.g. a 2716 in a 2732 socket) without reading the
+ whole ROM. A larger part (a 27128 in a 2764 socket) has its extra line held by the
+ board so it only shows one half and is left to the pass as a wrong ROM.
+
+*/
+
+static const UINT8 c_unstableReads = 8;
+static const UINT8 c_aliasPairs    = 8;
+
+void
+CRomFault::statsInit(
+    ROM_STATS *stats
+)
+{
+    stats->dataAnd = 0xFF;
+    stats->dataOr  = 0x00;
+    stats->count   = 0;
+    stats->dataXor = 0x00;
+    stats->dataSum = 0x00;
+}
+
+void
+CRomFault::statsUpdate(
+    ROM_STATS *stats,
+    UINT8     data
+)
+{
+    stats->dataAnd &= data;
+    stats->dataOr  |= data;
+    stats->count++;
+    stats->dataXor ^= data;
+    stats->dataSum += data;
+}
+
+CRomFault::CRomFault(
+    ICpu *cpu
+) : m_cpu(cpu)
+{
+}
+
+CRomFault::~CRomFault(
+)
+{
+}
+
+//
+// Number of address lines of a ROM of the given length, as the 2^n samples hold.
+//
+UINT8
+CRomFault::addressLines(
+    UINT32 length
+)
+{
+    UINT8 lines = 0;
+
+    for (UINT32 offset = 1 ; (offset < length) && (lines < 16) ; offset <<= 1)
+    {
+        lines++;
+    }
+
+    return lines;
+}
+
+//
+// e.g. "E:8D 2K in 4K" for a part decoding 11 lines of a 12 line socket.
+//
+void
+CRomFault::reportSize(
+    PERROR           error,
+    const ROM_REGION *region,
+    UINT8            decoded
+)
+{
+    UINT32 sizes[2] = {1UL << decoded, region->length};
+
+    error->code = ERROR_FAILED;
+    error->description = "E:";
+    error->description += region->location;
+
+    for (UINT8 i = 0 ; i < 2 ; i++)
+    {
+        error->description += (i == 0) ? " " : " in ";
+
+        if (sizes[i] >= 1024)
+        {
+            error->description += String(sizes[i] / 1024, DEC);
+            error->description += "K";
+        }
+        else
+        {
+            error->description += String(sizes[i], DEC);
+        }
+    }
+}
+
+//
+// Read the same addresses twice - a working part always returns the same data.
+//
+PERROR
+CRomFault::isUnstable(
+    const ROM_REGION *region,
+    bool             *unstable
+)
+{
+    PERROR error = errorSuccess;
+
+    *unstable = false;
+
+    for (UINT8 i = 0 ; i < c_unstableReads ; i++)
+    {
+        UINT32 address = region->start + (((UINT32) i * 0x2C9B) & (region->length - 1));
+        UINT16 first;
+        UINT16 second;
+
+        error = m_cpu->memoryRead(address, &first);
+        if (SUCCESS(error))
+        {
+            error = m_cpu->memoryRead(address, &second);
+        }
+        if (FAILED(error))
+        {
+            break;
+        }
+
+        if ((UINT8) first != (UINT8) second)
+        {
+            *unstable = true;
+            break;
+        }
+    }
+
+    return error;
+}
+
+//
+// An address line is aliased when its 2^n sample is wrong and pairs of
+// addresses differing only in that line always read the same.
+//
+PERROR
+CRomFault::isAliased(
+    const ROM_REGION *region,
+    UINT8            line,
+    bool             *aliased
+)
+{
+    PERROR error = errorSuccess;
+    UINT32 bit = (1UL << line);
+    UINT16 data;
+
+    *aliased = false;
+
+    error = m_cpu->memoryRead(region->start + bit, &data);
+    if (FAILED(error) || ((UINT8) data == (UINT8) region->data2n[line]))
+    {
+        return error;
+    }
+
+    for (UINT8 i = 0 ; i < c_aliasPairs ; i++)
+    {
+        UINT32 offset = (((UINT32) i * 0x9E37 + 0x1F3) & (region->length - 1)) & ~bit;
+        UINT16 low;
+        UINT16 high;
+
+        error = m_cpu->memoryRead(region->start + offset, &low);
+        if (SUCCESS(error))
+        {
+            error = m_cpu->memoryRead(region->start + (offset | bit), &high);
+        }
+        if (FAILED(error) || ((UINT8) low != (UINT8) high))
+        {
+            return error;
+        }
+    }
+
+    *aliased = true;
+
+    return error;
+}
+
+PERROR
+CRomFault::probeSize(
+    const ROM_REGION *region
+)
+{
+    PERROR error = errorSuccess;
+    UINT8 lines = addressLines(region->length);
+    UINT8 decoded = lines;
+
+    while (decoded > 0)
+    {
+        bool aliased = false;
+
+        error = isAliased(region, decoded - 1, &aliased);
+        if (FAILED(error))
+        {
+            return error;
+        }
+
+        if (!aliased)
+        {
+            break;
+        }
+
+        decoded--;
+    }
+
+    // Every line aliased is a constant bus - empty socket or no part - left to the pass.
+    if ((decoded == lines) || (decoded == 0))
+    {
+        return errorSuccess;
+    }
+
+    error = errorCustom;
+    reportSize(error, region, decoded);
+
+    return error;
+}
+
+PERROR
+CRomFault::classify(
+    const ROM_REGION *region,
+    const ROM_STATS  *stats,
+    bool             *corrupt
+)
+{
+    PERROR error = errorSuccess;
+    UINT8 lines = 0;
+    UINT8 expectedAnd = 0xFF;
+    UINT8 expectedOr  = 0x00;
+    UINT8 badSamples  = 0;
+    bool unstable = false;
+
+    *corrupt = false;
+
+    for (UINT32 offset = 1 ; (offset < region->length) && (lines < 16) ; offset <<= 1)
+    {
+        UINT16 data;
+        UINT8 expected = (UINT8) region->data2n[lines];
+
+        error = m_cpu->memoryRead(region->start + offset, &data);
+        if (FAILED(error))
+        {
+            return error;
+        }
+
+        expectedAnd &= expected;
+        expectedOr  |= expected;
+
+        if ((UINT8) data != expected)
+        {
+            badSamples++;
+        }
+
+        lines++;
+    }
+
+    error = isUnstable(region, &unstable);
+    if (FAILED(error))
+    {
+        return error;
+    }
+
+    error = errorCustom;
+    error->code = ERROR_FAILED;
+    error->description = "E:";
+    error->description += region->location;
+
+    if (stats->dataAnd == stats->dataOr)
+    {
+        error->description += (stats->dataAnd == 0xFF) ? " empty " : " no ROM ";
+        STRING_UINT8_HEX(error->description, stats->dataAnd);
+        return error;
+    }
+
+    if (unstable)
+    {
+        error->description += " floating";
+        return error;
+    }
+
+    for (UINT8 bit = 0 ; bit < 8 ; bit++)
+    {
+        UINT8 mask = (1 << bit);
+        bool stuckLow  = ((expectedOr & mask) != 0) && ((stats->dataOr & mask) == 0);
+        bool stuckHigh = ((expectedAnd & mask) == 0) && ((stats->dataAnd & mask) != 0);
+
+        if (stuckLow || stuckHigh)
+        {
+            error->description += " D";
+            error->description += String(bit, DEC);
+            error->description += stuckLow ? " lo" : " hi";
+            return error;
+        }
+    }
+
+    for (UINT8 line = 0 ; line < lines ; line++)
+    {
+        bool aliased = false;
+
+        error = isAliased(region, line, &aliased);
+        if (FAILED(error))
+        {
+            return error;
+        }
+
+        if (aliased)
+        {
+            error = errorCustom;
+
+            if (line == lines - 1)
+            {
+                reportSize(error, region, line);
+            }
+            else
+            {
+                error->code = ERROR_FAILED;
+                error->description = "E:";
+                error->description += region->location;
+                error->description += " A";
+                error->description += String(line, DEC);
+                error->description += " dead";
+            }
+            return error;
+        }
+    }
+
+    error = errorCustom;
+    error->code = ERROR_FAILED;
+    error->description = "E:";
+    error->description += region->location;
+
+    if (badSamples * 2 > lines)
+    {
+        error->description += " wrong ROM";
+    }
+    else
+    {
+        error->description += " corrupt";
+        *corrupt = true;
+    }
+
+    return error;
+}
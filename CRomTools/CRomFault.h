@@ -0,0 +1,110 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef CRomFault_h
+#define CRomFault_h
+
+#include "ICpu.h"
+
+//
+// Statistics gathered while a ROM is streamed, for the fault classifier.
+//
+typedef struct _ROM_STATS {
+    UINT8  dataAnd;   // AND of every byte read - bits that were never 0
+    UINT8  dataOr;    // OR of every byte read  - bits that were never 1
+    UINT32 count;     // Number of bytes read
+    UINT8  dataXor;   // XOR of every byte read - the checksums of the Atari self-tests
+    UINT8  dataSum;   // 8 bit sum of every byte read
+} ROM_STATS;
+
+//
+// Classifies why a ROM failed its CRC using the statistics of the pass and
+// a handful of targeted reads. The ROM's bank must still be selected.
+//
+class CRomFault
+{
+    public:
+
+        static void statsInit(
+                              ROM_STATS *stats
+        );
+
+        static void statsUpdate(
+                                ROM_STATS *stats,
+                                UINT8     data
+        );
+
+        CRomFault(
+                  ICpu *cpu
+        );
+
+        ~CRomFault(
+        );
+
+        //
+        // Returns errorCustom describing the fault, e.g. "E:8D D3 lo". corrupt is set
+        // when the ROM looks like a working part holding bad data.
+        //
+        PERROR classify(
+                        const ROM_REGION *region,
+                        const ROM_STATS  *stats,
+                        bool             *corrupt
+        );
+
+        //
+        // Find the highest address line the part decodes from the top lines of the socket
+        // that alias (a few dozen reads at most). Returns errorSuccess if the part fills
+        // the socket, otherwise errorCustom describing it, e.g. "E:8D 2K in 4K".
+        //
+        PERROR probeSize(
+                         const ROM_REGION *region
+        );
+
+    private:
+
+        static UINT8 addressLines(
+                                  UINT32 length
+        );
+
+        static void reportSize(
+                               PERROR           error,
+                               const ROM_REGION *region,
+                               UINT8            decoded
+        );
+
+        PERROR isUnstable(
+                          const ROM_REGION *region,
+                          bool             *unstable
+        );
+
+        PERROR isAliased(
+                         const ROM_REGION *region,
+                         UINT8            line,
+                         bool             *aliased
+        );
+
+        ICpu *m_cpu;
+};
+
+#endif
@@ -0,0 +1,216 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "CRomFrame.h"
+#include "CCrc32.h"
+
+/*
+
+ The framing shared by the binary serial links to the PC - the ROM dump and the ROM
+ compare. Each frame carries a CRC32 so a corrupt frame is dropped rather than taken
+ as ROM data.
+
+*/
+
+CRomFrame::CRomFrame(
+) : m_crc(CCrc32::c_init)
+{
+}
+
+CRomFrame::~CRomFrame(
+)
+{
+}
+
+bool
+CRomFrame::open(
+)
+{
+    bool wasActive = false;
+
+    if (Serial)
+    {
+        wasActive = true;
+        Serial.end();
+    }
+
+    Serial.begin(ROM_FRAME_BAUD);
+    while (!Serial) {};
+
+    return wasActive;
+}
+
+void
+CRomFrame::close(
+    bool wasActive
+)
+{
+    Serial.flush();
+    Serial.end();
+
+    if (wasActive)
+    {
+        Serial.begin(9600);
+    }
+}
+
+void
+CRomFrame::begin(
+    UINT8  type,
+    UINT16 length
+)
+{
+    Serial.write((UINT8) ROM_FRAME_SYNC);
+
+    m_crc = CCrc32::c_init;
+
+    write(type);
+    write((UINT8) (length >> 0));
+    write((UINT8) (length >> 8));
+}
+
+void
+CRomFrame::write(
+    UINT8 data
+)
+{
+    Serial.write(data);
+    m_crc = CCrc32::update(m_crc, data);
+}
+
+void
+CRomFrame::writeUINT32(
+    UINT32 data
+)
+{
+    for (UINT8 i = 0 ; i < 4 ; i++)
+    {
+        write((UINT8) (data >> (i * 8)));
+    }
+}
+
+void
+CRomFrame::end(
+)
+{
+    UINT32 crc = CCrc32::final(m_crc);
+
+    for (UINT8 i = 0 ; i < 4 ; i++)
+    {
+        Serial.write((UINT8) (crc >> (i * 8)));
+    }
+}
+
+bool
+CRomFrame::read(
+    UINT8  *data,
+    UINT32 timeout
+)
+{
+    UINT32 startTime = millis();
+
+    while (Serial.available() <= 0)
+    {
+        if (millis() - startTime >= timeout)
+        {
+            return false;
+        }
+    }
+
+    *data = (UINT8) Serial.read();
+
+    return true;
+}
+
+//
+// Bytes before the sync are skipped - e.g. the PC opening the port late.
+//
+bool
+CRomFrame::receive(
+    UINT8  *type,
+    UINT8  *payload,
+    UINT16 maxLength,
+    UINT16 *length,
+    UINT32 timeout
+)
+{
+    UINT32 crc = 0;
+    UINT8 data;
+
+    do
+    {
+        if (!read(&data, timeout))
+        {
+            return false;
+        }
+    }
+    while (data != ROM_FRAME_SYNC);
+
+    m_crc = CCrc32::c_init;
+
+    for (UINT8 i = 0 ; i < 3 ; i++)
+    {
+        if (!read(&data, timeout))
+        {
+            return false;
+        }
+
+        m_crc = CCrc32::update(m_crc, data);
+
+        if (i == 0)
+        {
+            *type = data;
+        }
+        else
+        {
+            *length = (i == 1) ? data : (*length | ((UINT16) data << 8));
+        }
+    }
+
+    if (*length > maxLength)
+    {
+        return false;
+    }
+
+    for (UINT16 i = 0 ; i < *length ; i++)
+    {
+        if (!read(&payload[i], timeout))
+        {
+            return false;
+        }
+
+        m_crc = CCrc32::update(m_crc, payload[i]);
+    }
+
+    for (UINT8 i = 0 ; i < 4 ; i++)
+    {
+        if (!read(&data, timeout))
+        {
+            return false;
+        }
+
+        crc |= (UINT32) data << (i * 8);
+    }
+
+    return (CCrc32::final(m_crc) == crc);
+}
@@ -0,0 +1,110 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef CRomFrame_h
+#define CRomFrame_h
+
+#include "Types.h"
+
+//
+// Serial rate for the binary links - 1M baud is exact from the Mega's 16MHz clock.
+//
+#ifndef ROM_FRAME_BAUD
+#define ROM_FRAME_BAUD 1000000
+#endif
+
+//
+// Frames are
+//
+//   0xA5, type, length (UINT16), payload (length bytes), CRC32 of type to payload (UINT32)
+//
+// all little endian. The frame types are those of the user, e.g. CRomDump.
+//
+#define ROM_FRAME_SYNC 0xA5
+
+class CRomFrame
+{
+    public:
+
+        CRomFrame(
+        );
+
+        ~CRomFrame(
+        );
+
+        //
+        // Open the port at ROM_FRAME_BAUD. Returns true if it was already in use so
+        // close() can put back the 9600 baud of the console.
+        //
+        static bool open(
+        );
+
+        static void close(
+                          bool wasActive
+        );
+
+        //
+        // Send a frame - begin with its type and payload length, the payload, then end.
+        //
+        void begin(
+                   UINT8  type,
+                   UINT16 length
+        );
+
+        void write(
+                   UINT8 data
+        );
+
+        void writeUINT32(
+                         UINT32 data
+        );
+
+        void end(
+        );
+
+        //
+        // Receive a frame into payload. Returns false if nothing starts within timeout ms,
+        // the frame is longer than maxLength or its CRC is bad.
+        //
+        bool receive(
+                     UINT8  *type,
+                     UINT8  *payload,
+                     UINT16 maxLength,
+                     UINT16 *length,
+                     UINT32 timeout
+        );
+
+        //
+        // Wait up to timeout ms for the next byte from the port.
+        //
+        static bool read(
+                         UINT8  *data,
+                         UINT32 timeout
+        );
+
+    private:
+
+        UINT32 m_crc;
+};
+
+#endif
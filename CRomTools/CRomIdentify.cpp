@@ -0,0 +1,306 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#include "CRomIdentify.h"
+
+/*
+
+ Identify which of a game's romsets is installed using only the 2^n data samples.
+
+ Every ROM_REGION already carries the data found at the power of 2 offsets of the ROM
+ (0x001, 0x002, 0x004 ...) for the address bit check. Sets of the same game share the
+ same sockets, so each distinct socket is read once (one bus read per address line) and
+ every set in the table is then scored against the cached samples.
+
+ e.g. the 12 Pacland sets share 10 sockets - 132 bus reads in total - compared to a full
+ CRC of 96KB of ROM per set.
+
+ Sets that differ only in their CRC (e.g. the Pacland hiscore mods) cannot be told apart
+ by the samples alone so the first matching set is reported along with the number of
+ other sets it could also be.
+
+*/
+
+CRomIdentify::CRomIdentify(
+    ICpu          *cpu,
+    void          *bankSwitchContext,
+    const ROM_SET *romSet
+) : m_cpu(cpu),
+    m_bankSwitchContext(bankSwitchContext),
+    m_romSet(romSet),
+    m_socketCount(0)
+{
+}
+
+CRomIdentify::~CRomIdentify(
+)
+{
+}
+
+//
+// Number of 2^n samples held for a ROM of the given length.
+//
+UINT8
+CRomIdentify::sampleCount(
+    UINT32 length
+)
+{
+    UINT8 count = 0;
+
+    for (UINT32 offset = 1 ; offset < length ; offset <<= 1)
+    {
+        count++;
+    }
+
+    return (count > ROM_IDENTIFY_MAX_SAMPLES) ? ROM_IDENTIFY_MAX_SAMPLES : count;
+}
+
+//
+// Find the cached socket that matches a ROM region, or NULL if it hasn't been seen yet.
+//
+CRomIdentify::ROM_SOCKET *
+CRomIdentify::findSocket(
+    const ROM_REGION *region
+)
+{
+    for (UINT8 i = 0 ; i < m_socketCount ; i++)
+    {
+        if ((m_socket[i].bankSwitch == region->bankSwitch) &&
+            (m_socket[i].start      == region->start)      &&
+            (m_socket[i].length     == region->length))
+        {
+            return &m_socket[i];
+        }
+    }
+
+    return (ROM_SOCKET *) NULL;
+}
+
+//
+// Read the 2^n samples of every distinct socket used by any set in the table.
+//
+PERROR
+CRomIdentify::readSockets(
+)
+{
+    PERROR error = errorSuccess;
+    BankSwitchCallback selected = NO_BANK_SWITCH;
+    ROM_SET set;
+
+    m_socketCount = 0;
+
+    for (UINT8 s = 0 ; ; s++)
+    {
+        memcpy_P(&set, &m_romSet[s], sizeof(set));
+
+        if (set.romRegion == NULL)
+        {
+            break;
+        }
+
+        for (UINT8 r = 0 ; ; r++)
+        {
+            ROM_REGION region;
+            ROM_SOCKET *socket;
+
+            memcpy_P(&region, &set.romRegion[r], sizeof(region));
+
+            if (region.length == 0)
+            {
+                break;
+            }
+
+            if (findSocket(&region) != NULL)
+            {
+                continue;
+            }
+
+            if (m_socketCount >= ROM_IDENTIFY_MAX_SOCKETS)
+            {
+                error = errorCustom;
+                error->code = ERROR_FAILED;
+                error->description = "E:Too many sockets";
+                return error;
+            }
+
+            socket = &m_socket[m_socketCount++];
+            socket->bankSwitch = region.bankSwitch;
+            socket->start      = region.start;
+            socket->length     = region.length;
+
+            // Sockets of the same bank are often found together - don't repeat the bank write.
+            if ((region.bankSwitch != NO_BANK_SWITCH) && (region.bankSwitch != selected))
+            {
+                error = region.bankSwitch(m_bankSwitchContext);
+                if (FAILED(error))
+                {
+                    return error;
+                }
+
+                selected = region.bankSwitch;
+            }
+
+            for (UINT8 i = 0 ; i < sampleCount(region.length) ; i++)
+            {
+                UINT16 data;
+
+                error = m_cpu->memoryRead(region.start + (1UL << i), &data);
+                if (FAILED(error))
+                {
+                    return error;
+                }
+
+                socket->data2n[i] = (ROM_SAMPLE) data;
+            }
+        }
+    }
+
+    return error;
+}
+
+//
+// Count the samples of a set that match the cached socket data.
+// The total number of samples in the set is returned via samples.
+//
+UINT16
+CRomIdentify::scoreSet(
+    const ROM_REGION *romRegion,
+    UINT16           *samples
+)
+{
+    UINT16 matched = 0;
+
+    *samples = 0;
+
+    for (UINT8 r = 0 ; ; r++)
+    {
+        ROM_REGION region;
+        ROM_SOCKET *socket;
+        UINT8 count;
+
+        memcpy_P(&region, &romRegion[r], sizeof(region));
+
+        if (region.length == 0)
+        {
+            break;
+        }
+
+        socket = findSocket(&region);
+        count  = sampleCount(region.length);
+
+        for (UINT8 i = 0 ; i < count ; i++)
+        {
+            if (socket->data2n[i] == (ROM_SAMPLE) region.data2n[i])
+            {
+                matched++;
+            }
+        }
+
+        *samples += count;
+    }
+
+    return matched;
+}
+
+//
+// Identify the installed romset.
+//
+// OK:<set>    - every sample matched this set.
+// OK:<set> +n - every sample matched but n other sets are indistinguishable by samples.
+// E:<set> s/t - no exact match; the closest set matched s of t samples.
+//
+PERROR
+CRomIdentify::identify(
+)
+{
+    PERROR error = errorSuccess;
+    ROM_SET set;
+    UINT8  bestSet     = 0;
+    UINT16 bestMatched = 0;
+    UINT16 bestSamples = 0;
+    UINT8  exactCount  = 0;
+
+    error = readSockets();
+    if (FAILED(error))
+    {
+        return error;
+    }
+
+    for (UINT8 s = 0 ; ; s++)
+    {
+        UINT16 samples = 0;
+        UINT16 matched = 0;
+
+        memcpy_P(&set, &m_romSet[s], sizeof(set));
+
+        if (set.romRegion == NULL)
+        {
+            break;
+        }
+
+        matched = scoreSet(set.romRegion, &samples);
+
+        if (matched == samples)
+        {
+            exactCount++;
+        }
+
+        // Keep the first of any equally good sets so the table order sets the preference.
+        if ((s == 0) || ((UINT32) matched * bestSamples > (UINT32) bestMatched * samples))
+        {
+            bestSet     = s;
+            bestMatched = matched;
+            bestSamples = samples;
+        }
+    }
+
+    memcpy_P(&set, &m_romSet[bestSet], sizeof(set));
+
+    error = errorCustom;
+
+    if ((bestSamples != 0) && (bestMatched == bestSamples))
+    {
+        error->code = ERROR_SUCCESS;
+        error->description = "OK:";
+        error->description += set.description;
+
+        if (exactCount > 1)
+        {
+            error->description += " +";
+            error->description += String(exactCount - 1, DEC);
+        }
+    }
+    else
+    {
+        error->code = ERROR_FAILED;
+        error->description = "E:";
+        error->description += set.description;
+        error->description += " ";
+        error->description += String(bestMatched, DEC);
+        error->description += "/";
+        error->description += String(bestSamples, DEC);
+    }
+
+    return error;
+}
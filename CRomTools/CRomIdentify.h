@@ -0,0 +1,102 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef CRomIdentify_h
+#define CRomIdentify_h
+
+#include "ICpu.h"
+
+//
+// A romset that can be identified by its 2^n data samples.
+// Tables of these are PROGMEM and terminated with {0}.
+//
+typedef struct _ROM_SET {
+    const ROM_REGION *romRegion;       // The PROGMEM ROM_REGION table for this set
+    char             description[11];  // "0123456789" - shown on the LCD when this set is found
+} ROM_SET;
+
+//
+// Maximum number of distinct ROM sockets (address, size and bank) across
+// all the sets in a table, and the maximum number of 2^n samples per ROM.
+//
+#define ROM_IDENTIFY_MAX_SOCKETS 16
+#define ROM_IDENTIFY_MAX_SAMPLES 16
+
+//
+// Every CPU board in this tree has an 8-bit data bus so the cached socket
+// samples are kept packed as bytes - the game tables stay UINT16 as they
+// belong to the ROM_REGION format and only their low byte is compared.
+//
+typedef UINT8 ROM_SAMPLE;
+
+class CRomIdentify
+{
+    public:
+
+        CRomIdentify(
+                     ICpu          *cpu,
+                     void          *bankSwitchContext,
+                     const ROM_SET *romSet
+        );
+
+        ~CRomIdentify(
+        );
+
+        PERROR identify(
+        );
+
+    private:
+
+        typedef struct _ROM_SOCKET {
+            BankSwitchCallback bankSwitch;
+            UINT32             start;
+            UINT32             length;
+            ROM_SAMPLE         data2n[ROM_IDENTIFY_MAX_SAMPLES];
+        } ROM_SOCKET;
+
+        PERROR readSockets(
+        );
+
+        ROM_SOCKET *findSocket(
+                               const ROM_REGION *region
+        );
+
+        UINT16 scoreSet(
+                        const ROM_REGION *romRegion,
+                        UINT16           *samples
+        );
+
+        static UINT8 sampleCount(
+                                 UINT32 length
+        );
+
+        ICpu          *m_cpu;
+        void          *m_bankSwitchContext;
+        const ROM_SET *m_romSet;
+
+        ROM_SOCKET    m_socket[ROM_IDENTIFY_MAX_SOCKETS];
+        UINT8         m_socketCount;
+};
+
+#endif
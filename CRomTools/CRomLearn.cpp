@@ -0,0 +1,464 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "CRomLearn.h"
+
+/*
+
+ Learn the romset of a known-good board - a new table in one pass, with no chips pulled.
+
+ Each region of the layout is read once with a CRomStream. This is its only consumer,
+ taking the CRC32 and keeping the bytes at the 2^n offsets (0x001, 0x002, 0x004 ...) as
+ they go by, so the samples cost no extra bus reads.
+
+ The sample arrays are printed as each region is read and the table at the end, over the
+ serial port at 9600 baud as the EAROM dump, e.g.
+
+   static const UINT16 s_romData_8B[] = {0x3b,0x19,0xc8,0x63,...}; //0x2DCEC84D
+   ...
+   static const ROM_REGION s_romRegionLearn[] PROGMEM = { //
+       {NO_BANK_SWITCH, 0x8000, 0x4000, s_romData_8B, 0x2DCEC84D, "8B "},
+       {bankSwitch_8E0, 0x4000, 0x2000, s_romData_8E0, 0xF9325FED, "8E0"},
+       ...
+       {0} }; // end of list
+
+ ready to paste into the game. A read failure stops the learn and nothing more is
+ printed, so a partial table is never mistaken for a complete one.
+
+*/
+
+CRomLearn::CRomLearn(
+    ICpu *cpu,
+    void *bankSwitchContext
+) : m_cpu(cpu),
+    m_bankSwitchContext(bankSwitchContext),
+    m_crc(CCrc32::c_init),
+    m_layout((const ROM_REGION *) NULL),
+    m_socketCount(0)
+{
+}
+
+CRomLearn::~CRomLearn(
+)
+{
+}
+
+UINT8
+CRomLearn::sampleCount(
+    UINT32 length
+)
+{
+    UINT8 count = 0;
+
+    for (UINT32 offset = 1 ; offset < length ; offset <<= 1)
+    {
+        count++;
+    }
+
+    return (count > ROM_LEARN_MAX_SAMPLES) ? ROM_LEARN_MAX_SAMPLES : count;
+}
+
+void
+CRomLearn::begin(
+    UINT32 length
+)
+{
+    m_crc = CCrc32::c_init;
+    memset(m_data2n, 0, sizeof(m_data2n));
+}
+
+bool
+CRomLearn::consume(
+    UINT32      offset,
+    const UINT8 *data,
+    UINT16      length
+)
+{
+    for (UINT16 i = 0 ; i < length ; i++, offset++)
+    {
+        m_crc = CCrc32::update(m_crc, data[i]);
+
+        // Only the power of 2 offsets are samples.
+        if ((offset != 0) && ((offset & (offset - 1)) == 0))
+        {
+            UINT8 sample = 0;
+
+            while ((1UL << sample) != offset)
+            {
+                sample++;
+            }
+
+            if (sample < ROM_LEARN_MAX_SAMPLES)
+            {
+                m_data2n[sample] = data[i];
+            }
+        }
+    }
+
+    return true;
+}
+
+void
+CRomLearn::end(
+)
+{
+    m_crc = CCrc32::final(m_crc);
+}
+
+//
+// The location as part of a C name, with the padding dropped and anything that can't go
+// in one as '_' (e.g. "8E0" -> s_romData_8E0).
+//
+void
+CRomLearn::printName(
+    const ROM_REGION *region
+)
+{
+    for (UINT8 i = 0 ; (i < sizeof(region->location)) && (region->location[i] != '\0') ; i++)
+    {
+        char c = region->location[i];
+
+        if (c == ' ')
+        {
+            continue;
+        }
+
+        Serial.print(isalnum(c) ? c : '_');
+    }
+}
+
+void
+CRomLearn::printSamples(
+    const ROM_REGION *region
+)
+{
+    char buf[24];
+
+    Serial.print(F("static const UINT16 s_romData_"));
+    printName(region);
+    Serial.print(F("[] = {"));
+
+    for (UINT8 i = 0 ; i < sampleCount(region->length) ; i++)
+    {
+        sprintf(buf, "%s0x%.2x", (i == 0) ? "" : ",", m_data2n[i]);
+        Serial.print(buf);
+    }
+
+    sprintf(buf, "}; //0x%.8lX", (unsigned long) m_crc);
+    Serial.println(buf);
+}
+
+void
+CRomLearn::printRegion(
+    const ROM_REGION *region,
+    UINT32           crc
+)
+{
+    char buf[24];
+
+    Serial.print(F("    {"));
+
+    if (region->bankSwitch == NO_BANK_SWITCH)
+    {
+        Serial.print(F("NO_BANK_SWITCH"));
+    }
+    else
+    {
+        // The callback can't be named from its address - the game's own replaces this.
+        Serial.print(F("bankSwitch_"));
+        printName(region);
+    }
+
+    sprintf(buf, ", 0x%.4lX, 0x%.4lX, ", (unsigned long) region->start, (unsigned long) region->length);
+    Serial.print(buf);
+    Serial.print(F("s_romData_"));
+    printName(region);
+
+    sprintf(buf, ", 0x%.8lX, \"", (unsigned long) crc);
+    Serial.print(buf);
+
+    for (UINT8 i = 0 ; (i < sizeof(region->location)) && (region->location[i] != '\0') ; i++)
+    {
+        Serial.print(region->location[i]);
+    }
+
+    Serial.println(F("\"},"));
+}
+
+//
+// Region index of the layout - the PROGMEM table, or the sockets sent over serial.
+//
+void
+CRomLearn::getRegion(
+    UINT8      index,
+    ROM_REGION *region
+)
+{
+    if (m_layout != NULL)
+    {
+        memcpy_P(region, &m_layout[index], sizeof(*region));
+        return;
+    }
+
+    memset(region, 0, sizeof(*region));
+    region->bankSwitch = NO_BANK_SWITCH;
+
+    if (index < m_socketCount)
+    {
+        region->start  = m_socket[index].start;
+        region->length = m_socket[index].length;
+        memcpy(region->location, m_socket[index].location, sizeof(region->location));
+    }
+}
+
+//
+// Open the serial port at 9600 baud if it isn't already. Returns true if it was open.
+//
+bool
+CRomLearn::openSerial(
+)
+{
+    if (Serial)
+    {
+        return true;
+    }
+
+    Serial.begin(9600);
+    while (!Serial) {};
+
+    return false;
+}
+
+//
+// Leave the serial port the way it was found.
+//
+void
+CRomLearn::closeSerial(
+    bool serialWasActive
+)
+{
+    if (!serialWasActive)
+    {
+        Serial.flush();
+        Serial.end();
+    }
+}
+
+//
+// OK: n ROMs   - the table of n ROMs has been printed.
+//
+PERROR
+CRomLearn::learn(
+    const ROM_REGION *layout
+)
+{
+    PERROR error = errorSuccess;
+    bool serialWasActive = openSerial();
+
+    m_layout = layout;
+    error = learnLayout();
+
+    closeSerial(serialWasActive);
+
+    return error;
+}
+
+//
+// OK: n ROMs       - the table of the n ROMs sent has been printed.
+// E:Layout line n  - line n isn't "<start> <length> <location>", or is one too many.
+//
+PERROR
+CRomLearn::learnSerial(
+)
+{
+    PERROR error = errorSuccess;
+    bool serialWasActive = openSerial();
+    char line[32];
+    UINT8 pos = 0;
+
+    m_layout = (const ROM_REGION *) NULL;
+    m_socketCount = 0;
+
+    Serial.println(F("// Send the layout - <start> <length> <location> in hex, one ROM a line,"));
+    Serial.println(F("// then an empty line"));
+
+    while (SUCCESS(error))
+    {
+        char c;
+        char *next;
+        ROM_LEARN_SOCKET *socket = &m_socket[m_socketCount];
+
+        if (Serial.available() <= 0)
+        {
+            continue;
+        }
+
+        c = (char) Serial.read();
+
+        if (c == '\r')
+        {
+            continue;
+        }
+
+        if (c != '\n')
+        {
+            if (pos < (sizeof(line) - 1))
+            {
+                line[pos++] = c;
+            }
+
+            continue;
+        }
+
+        line[pos] = '\0';
+
+        if (pos == 0)
+        {
+            break;
+        }
+
+        pos = 0;
+
+        if (m_socketCount >= ROM_LEARN_MAX_SOCKETS)
+        {
+            error = errorCustom;
+            error->code = ERROR_FAILED;
+            error->description = "E:Layout line ";
+            error->description += String(m_socketCount + 1, DEC);
+            break;
+        }
+
+        memset(socket, 0, sizeof(*socket));
+        socket->start  = strtoul(line, &next, 16);
+        socket->length = strtoul(next, &next, 16);
+
+        while (*next == ' ')
+        {
+            next++;
+        }
+
+        for (UINT8 i = 0 ; i < (sizeof(socket->location) - 1) ; i++)
+        {
+            socket->location[i] = ((*next != '\0') && (*next != ' ')) ? *next++ : ' ';
+        }
+
+        if ((socket->length == 0) || (socket->location[0] == ' '))
+        {
+            error = errorCustom;
+            error->code = ERROR_FAILED;
+            error->description = "E:Layout line ";
+            error->description += String(m_socketCount + 1, DEC);
+            break;
+        }
+
+        m_socketCount++;
+    }
+
+    if (SUCCESS(error))
+    {
+        error = learnLayout();
+    }
+
+    closeSerial(serialWasActive);
+
+    return error;
+}
+
+PERROR
+CRomLearn::learnLayout(
+)
+{
+    PERROR error = errorSuccess;
+    CRomStream stream(m_cpu);
+    BankSwitchCallback selected = NO_BANK_SWITCH;
+    UINT8 count = 0;
+
+    stream.add(this);
+
+    Serial.println(F("// Learnt from the board"));
+
+    for ( ; ; count++)
+    {
+        ROM_REGION region;
+
+        getRegion(count, &region);
+
+        if (region.length == 0)
+        {
+            break;
+        }
+
+        if (count >= ROM_LEARN_MAX_REGIONS)
+        {
+            error = errorCustom;
+            error->code = ERROR_FAILED;
+            error->description = "E:Too many ROMs";
+            break;
+        }
+
+        // Regions of the same bank are usually together - don't repeat the bank write.
+        if ((region.bankSwitch != NO_BANK_SWITCH) && (region.bankSwitch != selected))
+        {
+            error = region.bankSwitch(m_bankSwitchContext);
+            if (FAILED(error))
+            {
+                break;
+            }
+
+            selected = region.bankSwitch;
+        }
+
+        error = stream.read(&region);
+        if (FAILED(error))
+        {
+            break;
+        }
+
+        m_regionCrc[count] = m_crc;
+        printSamples(&region);
+    }
+
+    if (SUCCESS(error))
+    {
+        Serial.println();
+        Serial.println(F("static const ROM_REGION s_romRegionLearn[] PROGMEM = { //"));
+
+        for (UINT8 r = 0 ; r < count ; r++)
+        {
+            ROM_REGION region;
+
+            getRegion(r, &region);
+            printRegion(&region, m_regionCrc[r]);
+        }
+
+        Serial.println(F("    {0} }; // end of list"));
+
+        error = errorCustom;
+        error->code = ERROR_SUCCESS;
+        error->description = "OK: ";
+        error->description += String(count, DEC);
+        error->description += " ROMs";
+    }
+
+    return error;
+}
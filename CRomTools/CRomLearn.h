@@ -0,0 +1,168 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef CRomLearn_h
+#define CRomLearn_h
+
+#include "ICpu.h"
+#include "CCrc32.h"
+#include "CRomStream.h"
+
+//
+// Maximum number of regions in a layout.
+//
+#define ROM_LEARN_MAX_REGIONS 32
+
+//
+// Maximum number of sockets in a layout sent over serial.
+//
+#define ROM_LEARN_MAX_SOCKETS 16
+
+//
+// Maximum number of 2^n samples of a region (a 64KB window).
+//
+#define ROM_LEARN_MAX_SAMPLES 16
+
+//
+// A socket of a layout sent over serial - the part of a ROM_REGION it gives.
+//
+typedef struct _ROM_LEARN_SOCKET {
+    UINT32 start;
+    UINT32 length;
+    char   location[4];
+} ROM_LEARN_SOCKET;
+
+//
+// Reads every ROM of a known-good board and prints a ROM_REGION table for it over
+// serial, the samples and CRCs taken from the board rather than from images.
+//
+// The layout is a PROGMEM ROM_REGION table - usually the game's own table, as a new
+// revision keeps the sockets - of which only the bank switch, start, length and
+// location are used. A board with no table yet can be given one without data:
+//
+//   static const ROM_REGION s_romLayout[] PROGMEM = { //
+//       {NO_BANK_SWITCH, 0x6800, 0x0800, NULL, 0, "J2 "},
+//       ...
+//       {0} }; // end of list
+//
+// or, with no new game class at all, its layout can be sent over serial to learnSerial().
+//
+// The output is in the form printed by extras/rom_table_gen.cpp. A bank switched
+// region's callback is printed as bankSwitch_<location> to be replaced with the
+// game's own.
+//
+class CRomLearn : public IRomConsumer
+{
+    public:
+
+        CRomLearn(
+                  ICpu *cpu,
+                  void *bankSwitchContext
+        );
+
+        ~CRomLearn(
+        );
+
+        //
+        // Read every region of the PROGMEM layout once and print its table.
+        //
+        PERROR learn(
+                     const ROM_REGION *layout
+        );
+
+        //
+        // For a board with no table - read a layout over serial, one ROM a line as
+        // "<start> <length> <location>" in hex ended by an empty line, and learn it:
+        //
+        //   6800 0800 J2
+        //   7000 0800 K2
+        //
+        // Any game on the same CPU board can run it. Up to ROM_LEARN_MAX_SOCKETS ROMs
+        // are read unbanked - a bank switched board needs a PROGMEM layout.
+        //
+        PERROR learnSerial(
+        );
+
+        //
+        // IRomConsumer - the CRC32 and 2^n samples of a pass.
+        //
+        void begin(
+                   UINT32 length
+        );
+
+        bool consume(
+                     UINT32      offset,
+                     const UINT8 *data,
+                     UINT16      length
+        );
+
+        void end(
+        );
+
+    private:
+
+        void getRegion(
+                       UINT8      index,
+                       ROM_REGION *region
+        );
+
+        static bool openSerial(
+        );
+
+        static void closeSerial(
+                                bool serialWasActive
+        );
+
+        PERROR learnLayout(
+        );
+
+        static UINT8 sampleCount(
+                                 UINT32 length
+        );
+
+        static void printName(
+                              const ROM_REGION *region
+        );
+
+        void printSamples(
+                          const ROM_REGION *region
+        );
+
+        void printRegion(
+                         const ROM_REGION *region,
+                         UINT32           crc
+        );
+
+        ICpu   *m_cpu;
+        void   *m_bankSwitchContext;
+
+        UINT32 m_crc;
+        UINT8  m_data2n[ROM_LEARN_MAX_SAMPLES];
+        UINT32 m_regionCrc[ROM_LEARN_MAX_REGIONS];
+
+        const ROM_REGION *m_layout;                 // PROGMEM layout, or NULL for m_socket
+        ROM_LEARN_SOCKET m_socket[ROM_LEARN_MAX_SOCKETS];
+        UINT8            m_socketCount;
+};
+
+#endif
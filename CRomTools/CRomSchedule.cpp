@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#include "CRomSchedule.h"
+
+/*
+
+ Banked ROMs (e.g. Pacland 8E-8J paged in at 0x4000 by a write to MPAGE) each have a
+ bank switch callback in their ROM_REGION. Walking the table in order and switching for
+ every region repeats the bank write whenever regions of the same bank aren't adjacent
+ or a bank is used again. The schedule groups the regions by their callback, keeping the
+ table order within a group, and only calls a callback when it's different to the last
+ one called - one bank write per bank for each run through the table.
+
+ The last bank is only remembered for the life of the schedule so a board reset between
+ runs can't leave it stale.
+
+*/
+
+CRomSchedule::CRomSchedule(
+    const ROM_REGION *romRegion,
+    void             *bankSwitchContext
+) : m_romRegion(romRegion),
+    m_bankSwitchContext(bankSwitchContext),
+    m_count(0),
+    m_next(0),
+    m_overflow(false),
+    m_selected(NO_BANK_SWITCH)
+{
+    BankSwitchCallback bank[ROM_SCHEDULE_MAX_REGIONS + 1];
+    UINT8 banks = 0;
+    UINT8 regions = 0;
+
+    // The distinct callbacks in the order they first appear, unbanked first.
+    bank[banks++] = NO_BANK_SWITCH;
+
+    for ( ; regions < ROM_SCHEDULE_MAX_REGIONS ; regions++)
+    {
+        ROM_REGION region;
+        UINT8 b;
+
+        memcpy_P(&region, &romRegion[regions], sizeof(region));
+
+        if (region.length == 0)
+        {
+            break;
+        }
+
+        for (b = 0 ; (b < banks) && (bank[b] != region.bankSwitch) ; b++);
+
+        if (b == banks)
+        {
+            bank[banks++] = region.bankSwitch;
+        }
+    }
+
+    // The regions past the limit aren't scheduled - check() reports them.
+    m_overflow = (regions == ROM_SCHEDULE_MAX_REGIONS) &&
+                 (pgm_read_dword(&romRegion[regions].length) != 0);
+
+    for (UINT8 b = 0 ; b < banks ; b++)
+    {
+        for (UINT8 r = 0 ; r < regions ; r++)
+        {
+            if ((BankSwitchCallback) pgm_read_ptr(&romRegion[r].bankSwitch) == bank[b])
+            {
+                m_order[m_count++] = r;
+            }
+        }
+    }
+}
+
+CRomSchedule::~CRomSchedule(
+)
+{
+}
+
+PERROR
+CRomSchedule::check(
+)
+{
+    PERROR error = errorSuccess;
+
+    if (m_overflow)
+    {
+        error = errorCustom;
+        error->code = ERROR_FAILED;
+        error->description = "E:>";
+        error->description += String(ROM_SCHEDULE_MAX_REGIONS, DEC);
+        error->description += " ROMs";
+    }
+
+    return error;
+}
+
+bool
+CRomSchedule::next(
+    ROM_REGION *region
+)
+{
+    if (m_next >= m_count)
+    {
+        return false;
+    }
+
+    memcpy_P(region, &m_romRegion[m_order[m_next++]], sizeof(*region));
+
+    return true;
+}
+
+PERROR
+CRomSchedule::select(
+    const ROM_REGION *region
+)
+{
+    PERROR error = errorSuccess;
+
+    if ((region->bankSwitch != NO_BANK_SWITCH) && (region->bankSwitch != m_selected))
+    {
+        error = region->bankSwitch(m_bankSwitchContext);
+        if (FAILED(error))
+        {
+            m_selected = NO_BANK_SWITCH;
+            return error;
+        }
+
+        m_selected = region->bankSwitch;
+    }
+
+    return error;
+}
+
+PERROR
+CRomSchedule::bankSelect(
+    ICpu              *cpu,
+    const BANK_SELECT *bankSelect
+)
+{
+    BANK_SELECT select;
+
+    memcpy_P(&select, bankSelect, sizeof(select));
+
+    return cpu->memoryWrite(select.address, select.value);
+}
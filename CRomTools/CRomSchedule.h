@@ -0,0 +1,103 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef CRomSchedule_h
+#define CRomSchedule_h
+
+#include "ICpu.h"
+
+//
+// A bank switch expressed as data - the value to write to the bank register.
+// Tables of these are PROGMEM, indexed by the game's bank number.
+//
+typedef struct _BANK_SELECT {
+    UINT32 address;   // Bank register
+    UINT16 value;     // Value selecting the bank
+} BANK_SELECT;
+
+//
+// Maximum number of regions in a ROM_REGION table that can be scheduled.
+//
+#define ROM_SCHEDULE_MAX_REGIONS 32
+
+//
+// Orders the regions of a ROM_REGION table so the unbanked regions come first and
+// the regions of each bank are together, and switches bank only when the next region
+// needs a different bank to the one last selected by this schedule.
+//
+class CRomSchedule
+{
+    public:
+
+        CRomSchedule(
+                     const ROM_REGION *romRegion,
+                     void             *bankSwitchContext
+        );
+
+        ~CRomSchedule(
+        );
+
+        //
+        // Returns an error if the table has more regions than can be scheduled - check
+        // before next() so a partial board isn't reported as good.
+        //
+        PERROR check(
+        );
+
+        //
+        // Copies the next region in bank order. Returns false at the end of the table.
+        //
+        bool next(
+                  ROM_REGION *region
+        );
+
+        //
+        // Select the bank of a region if it isn't already selected.
+        //
+        PERROR select(
+                      const ROM_REGION *region
+        );
+
+        //
+        // Write a PROGMEM bank select entry - for the game's bank switch callbacks.
+        //
+        static PERROR bankSelect(
+                                 ICpu              *cpu,
+                                 const BANK_SELECT *bankSelect
+        );
+
+    private:
+
+        const ROM_REGION   *m_romRegion;
+        void               *m_bankSwitchContext;
+
+        UINT8              m_order[ROM_SCHEDULE_MAX_REGIONS];
+        UINT8              m_count;
+        UINT8              m_next;
+        bool               m_overflow;
+
+        BankSwitchCallback m_selected;
+};
+
+#endif
@@ -0,0 +1,153 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "CRomStream.h"
+
+/*
+
+ The CRC, the fault statistics, the block map, the serial dump and any later analysis
+ all want the same ROM bytes. Rather than each reading the ROM through memoryRead, a
+ stream reads it once, a buffer at a time, and hands every buffer to each consumer in
+ the order they were added. Another analysis is another consumer - no more bus cycles.
+
+ The buffer is small (ROM_STREAM_BUFFER_SIZE bytes) so consumers that send the bytes on,
+ like the serial dump, still overlap with the bus reads of the next buffer.
+
+*/
+
+CRomStream::CRomStream(
+    ICpu *cpu
+) : m_cpu(cpu),
+    m_consumerCount(0),
+    m_offset(0),
+    m_stopped(false)
+{
+}
+
+CRomStream::~CRomStream(
+)
+{
+}
+
+bool
+CRomStream::add(
+    IRomConsumer *consumer
+)
+{
+    if (m_consumerCount >= ROM_STREAM_MAX_CONSUMERS)
+    {
+        return false;
+    }
+
+    m_consumer[m_consumerCount++] = consumer;
+
+    return true;
+}
+
+void
+CRomStream::begin(
+    UINT32 length
+)
+{
+    m_offset  = 0;
+    m_stopped = false;
+
+    for (UINT8 c = 0 ; c < m_consumerCount ; c++)
+    {
+        m_consumer[c]->begin(length);
+    }
+}
+
+PERROR
+CRomStream::read(
+    UINT32 start,
+    UINT32 length
+)
+{
+    PERROR error = errorSuccess;
+
+    for (UINT32 address = 0 ; (address < length) && !m_stopped ; )
+    {
+        UINT16 size = ((length - address) < ROM_STREAM_BUFFER_SIZE) ?
+                      (UINT16) (length - address) : ROM_STREAM_BUFFER_SIZE;
+
+        for (UINT16 i = 0 ; i < size ; i++)
+        {
+            UINT16 data;
+
+            error = m_cpu->memoryRead(start + address + i, &data);
+            if (FAILED(error))
+            {
+                return error;
+            }
+
+            m_buffer[i] = (UINT8) data;
+        }
+
+        for (UINT8 c = 0 ; c < m_consumerCount ; c++)
+        {
+            if (!m_consumer[c]->consume(m_offset, m_buffer, size))
+            {
+                m_stopped = true;
+            }
+        }
+
+        address  += size;
+        m_offset += size;
+    }
+
+    return error;
+}
+
+void
+CRomStream::end(
+)
+{
+    for (UINT8 c = 0 ; c < m_consumerCount ; c++)
+    {
+        m_consumer[c]->end();
+    }
+}
+
+bool
+CRomStream::stopped(
+)
+{
+    return m_stopped;
+}
+
+PERROR
+CRomStream::read(
+    const ROM_REGION *region
+)
+{
+    PERROR error = errorSuccess;
+
+    begin(region->length);
+
+    error = read(region->start, region->length);
+
+    end();
+
+    return error;
+}
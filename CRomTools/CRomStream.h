@@ -0,0 +1,106 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef CRomStream_h
+#define CRomStream_h
+
+#include "ICpu.h"
+#include "IRomConsumer.h"
+
+//
+// Bytes read from the bus between calls to the consumers.
+//
+#define ROM_STREAM_BUFFER_SIZE 32
+
+//
+// Maximum number of consumers of one stream.
+//
+#define ROM_STREAM_MAX_CONSUMERS 4
+
+//
+// Reads a ROM once and passes each buffer of bytes to every registered consumer.
+//
+// stream.add(&crc);
+// stream.add(&dump);
+// error = stream.read(region);
+//
+class CRomStream
+{
+    public:
+
+        CRomStream(
+                   ICpu *cpu
+        );
+
+        ~CRomStream(
+        );
+
+        //
+        // Register a consumer. Returns false if there are already ROM_STREAM_MAX_CONSUMERS.
+        //
+        bool add(
+                 IRomConsumer *consumer
+        );
+
+        //
+        // Read a whole ROM in one pass. Its bank must already be selected.
+        //
+        PERROR read(
+                    const ROM_REGION *region
+        );
+
+        //
+        // A pass made of several windows, e.g. the slices of a bank switched chip:
+        // begin with the total length, read each window after selecting its bank, then end.
+        //
+        void begin(
+                   UINT32 length
+        );
+
+        PERROR read(
+                    UINT32 start,
+                    UINT32 length
+        );
+
+        void end(
+        );
+
+        //
+        // True if a consumer ended the pass early.
+        //
+        bool stopped(
+        );
+
+    private:
+
+        ICpu         *m_cpu;
+
+        IRomConsumer *m_consumer[ROM_STREAM_MAX_CONSUMERS];
+        UINT8        m_consumerCount;
+
+        UINT8        m_buffer[ROM_STREAM_BUFFER_SIZE];
+        UINT32       m_offset;
+        bool         m_stopped;
+};
+
+#endif
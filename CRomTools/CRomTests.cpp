@@ -0,0 +1,114 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "CRomTests.h"
+
+PERROR
+CRomTests::run(
+    ROM_TEST         test,
+    ICpu             *cpu,
+    void             *bankSwitchContext,
+    const ROM_REGION *romRegion,
+    const ROM_SET    *romSet,
+    const ROM_CHIP   *romChip
+)
+{
+    PERROR error = errorSuccess;
+
+    switch (test)
+    {
+        case ROM_TEST_IDENTIFY :
+        {
+            if (romSet == NULL)
+            {
+                break;
+            }
+
+            CRomIdentify romIdentify(cpu, bankSwitchContext, romSet);
+
+            return romIdentify.identify();
+        }
+
+        case ROM_TEST_VERIFY :
+        case ROM_TEST_VERIFY_FIRST :
+        {
+            CRomVerify romVerify(cpu, bankSwitchContext);
+
+            return romVerify.verify(romRegion, (test == ROM_TEST_VERIFY_FIRST));
+        }
+
+        case ROM_TEST_SAMPLE :
+        case ROM_TEST_QUICK :
+        {
+            CRomVerify romVerify(cpu, bankSwitchContext);
+
+            return romVerify.verifySampled(romRegion, (test == ROM_TEST_QUICK));
+        }
+
+        case ROM_TEST_DUMP :
+        {
+            CRomDump romDump(cpu, bankSwitchContext);
+
+            return romDump.dump(romRegion);
+        }
+
+        case ROM_TEST_COMPARE :
+        {
+            CRomCompare romCompare(cpu, bankSwitchContext);
+
+            return romCompare.compare(romRegion);
+        }
+
+        case ROM_TEST_LEARN :
+        {
+            CRomLearn romLearn(cpu, bankSwitchContext);
+
+            return romLearn.learn(romRegion);
+        }
+
+        case ROM_TEST_LAYOUT :
+        {
+            CRomLearn romLearn(cpu, bankSwitchContext);
+
+            return romLearn.learnSerial();
+        }
+
+        case ROM_TEST_CHIPS :
+        {
+            if (romChip == NULL)
+            {
+                break;
+            }
+
+            CRomVerify romVerify(cpu, bankSwitchContext);
+
+            return romVerify.verifyChips(romChip);
+        }
+    }
+
+    error = errorCustom;
+    error->code = ERROR_FAILED;
+    error->description = "E: N/A";
+
+    return error;
+}
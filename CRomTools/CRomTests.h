@@ -0,0 +1,75 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef CRomTests_h
+#define CRomTests_h
+
+#include "ICpu.h"
+#include "CRomIdentify.h"
+#include "CRomVerify.h"
+#include "CRomDump.h"
+#include "CRomCompare.h"
+#include "CRomLearn.h"
+
+//
+// The ROM tools a game's custom functions can run.
+//
+typedef enum {
+    ROM_TEST_IDENTIFY,          // CRomIdentify::identify
+    ROM_TEST_VERIFY,            // CRomVerify::verify, whole ROM
+    ROM_TEST_VERIFY_FIRST,      // CRomVerify::verify, stop at the first bad block
+    ROM_TEST_SAMPLE,            // CRomVerify::verifySampled, samples only
+    ROM_TEST_QUICK,             // CRomVerify::verifySampled, then a CRC of those that pass
+    ROM_TEST_DUMP,              // CRomDump::dump
+    ROM_TEST_COMPARE,           // CRomCompare::compare
+    ROM_TEST_LEARN,             // CRomLearn::learn of the game's table
+    ROM_TEST_LAYOUT,            // CRomLearn::learnSerial of a layout sent over serial
+    ROM_TEST_CHIPS              // CRomVerify::verifyChips
+} ROM_TEST;
+
+//
+// Runs one ROM tool against a game's tables so a base game needs one custom function
+// template rather than a wrapper per tool, e.g.
+//
+//   template <ROM_TEST test>
+//   static PERROR romTest(void *context) { return ((CMyBaseGame *) context)->runRomTest(test); }
+//
+//   {CMyBaseGame::romTest<ROM_TEST_VERIFY>, "ROM BlkMap"},
+//
+// romSet and romChip may be NULL if the game has none - those tools then report N/A.
+//
+class CRomTests
+{
+    public:
+
+        static PERROR run(
+                          ROM_TEST         test,
+                          ICpu             *cpu,
+                          void             *bankSwitchContext,
+                          const ROM_REGION *romRegion,
+                          const ROM_SET    *romSet,
+                          const ROM_CHIP   *romChip
+        );
+};
+
+#endif
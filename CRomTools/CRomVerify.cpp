@@ -0,0 +1,898 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#include "CRomVerify.h"
+
+/*
+
+ Verify ROMs against a map of per 256 byte block CRC32s of the good image.
+
+ A plain CRC only says that a ROM is bad. With the block map the failing blocks are
+ known and the pattern of them points at the fault:
+
+ - every block bad            - a data line, a low address line (A0-A7) or the wrong part.
+ - every block with An set    - address line An stuck low (reads alias the lower half).
+ - every block with An clear  - address line An stuck high.
+ - anything else              - the address of the first bad block and the number of others,
+                                e.g. bit rot in one block.
+
+ A ROM that fails a full pass is looked up by its CRC in the index of every known ROM
+ and reported as e.g. "E:8F =PunchOut J 8F" if it's a good image from another set,
+ socket or game (wrong revision or swapped parts). A single flipped bit is located from
+ the CRC syndrome. Otherwise it's classified by CRomFault (empty socket, stuck bit,
+ dead address line etc.) and only reported by its blocks when it looks like a working
+ part holding corrupt data. ROMs without a block map still get a whole image CRC.
+
+ Each ROM is read through a CRomStream with this class as a consumer (CRC32, fault
+ statistics and block map), so other consumers can share the pass.
+
+ Before a ROM is read its top address lines are probed for aliasing so a part smaller
+ than the socket is reported by size, e.g. "E:8D 2K in 4K", without the full pass.
+
+*/
+
+CRomVerify::CRomVerify(
+    ICpu *cpu,
+    void *bankSwitchContext
+) : m_cpu(cpu),
+    m_bankSwitchContext(bankSwitchContext),
+    m_badCount(0),
+    m_firstBad(0),
+    m_crc(0),
+    m_blockCrc(0),
+    m_length(0),
+    m_blockMap((const ROM_BLOCK_MAP *) NULL),
+    m_stopAtFirstBlock(false)
+{
+}
+
+CRomVerify::~CRomVerify(
+)
+{
+}
+
+//
+// Find the block map for an image by its CRC32, returning false if there isn't one.
+//
+bool
+CRomVerify::findBlockMap(
+    UINT32        crc,
+    ROM_BLOCK_MAP *blockMap
+)
+{
+    for (UINT16 i = 0 ; ; i++)
+    {
+        memcpy_P(blockMap, &g_romBlockMap[i], sizeof(*blockMap));
+
+        if (blockMap->length == 0)
+        {
+            break;
+        }
+
+        if (blockMap->crc == crc)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//
+// Binary search the CRC index for an image. Of several entries with the same CRC the
+// one in the same socket is preferred - that's a different revision of the same part.
+//
+bool
+CRomVerify::findCrc(
+    UINT32        crc,
+    const char    *location,
+    ROM_CRC_INDEX *entry
+)
+{
+    UINT16 low  = 0;
+    UINT16 high = g_romCrcIndexCount;
+
+    while (low < high)
+    {
+        UINT16 mid = low + (high - low) / 2;
+
+        if (pgm_read_dword(&g_romCrcIndex[mid].crc) < crc)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    if ((low >= g_romCrcIndexCount) || (pgm_read_dword(&g_romCrcIndex[low].crc) != crc))
+    {
+        return false;
+    }
+
+    memcpy_P(entry, &g_romCrcIndex[low], sizeof(*entry));
+
+    for (UINT16 i = low + 1 ; (i < g_romCrcIndexCount) && (pgm_read_dword(&g_romCrcIndex[i].crc) == crc) ; i++)
+    {
+        if (strncmp_P(location, g_romCrcIndex[i].location, sizeof(entry->location)) == 0)
+        {
+            memcpy_P(entry, &g_romCrcIndex[i], sizeof(*entry));
+            break;
+        }
+    }
+
+    return true;
+}
+
+//
+// Report a single bit error found from the CRC syndrome, e.g. "E:8D 4123 D5 3E". The syndrome
+// alone could be any fault that happens to land on a one bit difference, so it's confirmed
+// by a second pass: the ROM must give the good CRC with that one bit put back. The byte is
+// shown as it read in that pass. Returns errorSuccess if it isn't a stable single bit error.
+//
+PERROR
+CRomVerify::reportBitError(
+    const ROM_REGION *region
+)
+{
+    PERROR error = errorSuccess;
+    UINT32 offset;
+    UINT8  bit;
+    UINT8  bad = 0;
+    UINT16 data;
+    UINT32 crc = CCrc32::c_init;
+
+    if (!CCrc32::findBitError(region->crc, m_crc, region->length, &offset, &bit))
+    {
+        return errorSuccess;
+    }
+
+    for (UINT32 i = 0 ; i < region->length ; i++)
+    {
+        error = m_cpu->memoryRead(region->start + i, &data);
+        if (FAILED(error))
+        {
+            return error;
+        }
+
+        if (i == offset)
+        {
+            bad = (UINT8) data;
+            data ^= (1 << bit);
+        }
+
+        crc = CCrc32::update(crc, (UINT8) data);
+    }
+
+    if (CCrc32::final(crc) != region->crc)
+    {
+        return errorSuccess;
+    }
+
+    error = errorCustom;
+    error->code = ERROR_FAILED;
+    error->description = "E:";
+    error->description += region->location;
+    error->description += " ";
+    STRING_UINT32_HEX(error->description, region->start + offset);
+    error->description += " D";
+    error->description += String(bit, DEC);
+    error->description += " ";
+    STRING_UINT8_HEX(error->description, bad);
+
+    return error;
+}
+
+//
+// Report a ROM that's a good image from another set, socket or game, e.g. "E:8F =PunchOut J 8F".
+//
+void
+CRomVerify::reportKnownRom(
+    PERROR              error,
+    const char          *location,
+    const ROM_CRC_INDEX *entry
+)
+{
+    error->code = ERROR_FAILED;
+    error->description = "E:";
+    error->description += location;
+    error->description += " =";
+    error->description += entry->name;
+    error->description += " ";
+    error->description += entry->location;
+}
+
+bool
+CRomVerify::isBadBlock(
+    UINT16 block
+)
+{
+    return (m_badBlock[block >> 3] & (1 << (block & 7))) != 0;
+}
+
+void
+CRomVerify::begin(
+    UINT32 length
+)
+{
+    memset(m_badBlock, 0, sizeof(m_badBlock));
+    m_badCount = 0;
+    m_firstBad = 0;
+    m_crc      = CCrc32::c_init;
+    m_blockCrc = CCrc32::c_init;
+    m_length   = length;
+
+    CRomFault::statsInit(&m_stats);
+}
+
+bool
+CRomVerify::consume(
+    UINT32      offset,
+    const UINT8 *data,
+    UINT16      length
+)
+{
+    for (UINT16 i = 0 ; i < length ; i++, offset++)
+    {
+        m_crc = CCrc32::update(m_crc, data[i]);
+        CRomFault::statsUpdate(&m_stats, data[i]);
+
+        if (m_blockMap == NULL)
+        {
+            continue;
+        }
+
+        m_blockCrc = CCrc32::update(m_blockCrc, data[i]);
+
+        if (((offset + 1) % ROM_BLOCK_SIZE == 0) || (offset + 1 == m_length))
+        {
+            UINT16 block = (UINT16) (offset / ROM_BLOCK_SIZE);
+
+            if (CCrc32::final(m_blockCrc) != pgm_read_dword(&m_blockMap->blockCrc[block]))
+            {
+                if (m_badCount++ == 0)
+                {
+                    m_firstBad = block;
+                }
+
+                m_badBlock[block >> 3] |= (1 << (block & 7));
+
+                if (m_stopAtFirstBlock)
+                {
+                    return false;
+                }
+            }
+
+            m_blockCrc = CCrc32::c_init;
+        }
+    }
+
+    return true;
+}
+
+void
+CRomVerify::end(
+)
+{
+    m_crc = CCrc32::final(m_crc);
+}
+
+UINT32
+CRomVerify::crc(
+)
+{
+    return m_crc;
+}
+
+//
+// Read one ROM, checking each block against the map (if any) and the whole image CRC.
+//
+PERROR
+CRomVerify::verifyRegion(
+    CRomSchedule        *schedule,
+    const ROM_REGION    *region,
+    const ROM_BLOCK_MAP *blockMap,
+    bool                stopAtFirstBlock
+)
+{
+    PERROR error = errorSuccess;
+    CRomStream stream(m_cpu);
+
+    m_blockMap         = blockMap;
+    m_stopAtFirstBlock = stopAtFirstBlock;
+
+    error = schedule->select(region);
+    if (FAILED(error))
+    {
+        return error;
+    }
+
+    stream.add(this);
+
+    error = stream.read(region);
+
+    m_blockMap = (const ROM_BLOCK_MAP *) NULL;
+
+    return error;
+}
+
+//
+// Describe the bad blocks of a ROM in the error.
+//
+void
+CRomVerify::reportBlocks(
+    PERROR           error,
+    const ROM_REGION *region,
+    UINT16           blocks
+)
+{
+    error->code = ERROR_FAILED;
+    error->description = "E:";
+    error->description += region->location;
+
+    if (m_badCount == blocks)
+    {
+        error->description += " all blks";
+        return;
+    }
+
+    // A partial map (stopped at the first bad block) can't show an address line pattern.
+    for (UINT8 line = 0 ; (m_badCount > 1) && ((1U << line) < blocks) ; line++)
+    {
+        bool stuckLow  = true;
+        bool stuckHigh = true;
+
+        for (UINT16 block = 0 ; block < blocks ; block++)
+        {
+            bool set = (block & (1U << line)) != 0;
+
+            stuckLow  = stuckLow  && (isBadBlock(block) == set);
+            stuckHigh = stuckHigh && (isBadBlock(block) != set);
+        }
+
+        if (stuckLow || stuckHigh)
+        {
+            error->description += " A";
+            error->description += String(8 + line, DEC);
+            error->description += stuckLow ? " lo?" : " hi?";
+            return;
+        }
+    }
+
+    error->description += " ";
+    STRING_UINT32_HEX(error->description, region->start + ((UINT32) m_firstBad * ROM_BLOCK_SIZE));
+
+    if (m_badCount > 1)
+    {
+        error->description += " +";
+        error->description += String(m_badCount - 1, DEC);
+    }
+}
+
+PERROR
+CRomVerify::verify(
+    const ROM_REGION *romRegion,
+    bool             stopAtFirstBlock
+)
+{
+    PERROR error = errorSuccess;
+    CRomSchedule schedule(romRegion, m_bankSwitchContext);
+    ROM_REGION region;
+    UINT8 count = 0;
+
+    error = schedule.check();
+    if (FAILED(error))
+    {
+        return error;
+    }
+
+    // In bank order so each bank is selected once.
+    while (schedule.next(&region))
+    {
+        ROM_BLOCK_MAP blockMap;
+        bool          mapped;
+
+        mapped = findBlockMap(region.crc, &blockMap) &&
+                 (blockMap.length == region.length) &&
+                 (region.length <= (UINT32) ROM_BLOCK_SIZE * ROM_BLOCK_MAX);
+
+        // A part smaller than its socket shows in a few reads - no need to read it all.
+        error = schedule.select(&region);
+        if (SUCCESS(error))
+        {
+            CRomFault romFault(m_cpu);
+
+            error = romFault.probeSize(&region);
+        }
+        if (error != errorSuccess)
+        {
+            return error;
+        }
+
+        error = verifyRegion(&schedule, &region, mapped ? &blockMap : (ROM_BLOCK_MAP *) NULL, stopAtFirstBlock);
+        if (FAILED(error))
+        {
+            return error;
+        }
+
+        if ((m_badCount != 0) && stopAtFirstBlock)
+        {
+            error = errorCustom;
+            reportBlocks(error, &region, (UINT16) ((region.length + ROM_BLOCK_SIZE - 1) / ROM_BLOCK_SIZE));
+            return error;
+        }
+
+        if ((m_badCount != 0) || (m_crc != region.crc))
+        {
+            CRomFault romFault(m_cpu);
+            ROM_CRC_INDEX entry;
+            bool corrupt = false;
+
+            // A good image from another set, socket or game.
+            if (findCrc(m_crc, region.location, &entry))
+            {
+                error = errorCustom;
+                reportKnownRom(error, region.location, &entry);
+                return error;
+            }
+
+            // A single flipped bit - the CRC syndrome gives its position.
+            error = reportBitError(&region);
+            if (error != errorSuccess)
+            {
+                return error;
+            }
+
+            error = romFault.classify(&region, &m_stats, &corrupt);
+
+            // Corrupt data in a working part - the block map shows where.
+            if (corrupt && (m_badCount != 0))
+            {
+                error = errorCustom;
+                reportBlocks(error, &region, (UINT16) ((region.length + ROM_BLOCK_SIZE - 1) / ROM_BLOCK_SIZE));
+            }
+
+            return error;
+        }
+
+        count++;
+    }
+
+    error = errorCustom;
+    error->code = ERROR_SUCCESS;
+    error->description = "OK: ";
+    error->description += String(count, DEC);
+    error->description += " ROMs";
+
+    return error;
+}
+
+//
+// Read the 2^n samples of one ROM. Its bank must be selected.
+//
+PERROR
+CRomVerify::sampleRegion(
+    const ROM_REGION *region,
+    char             *fault
+)
+{
+    PERROR error = errorSuccess;
+    UINT8 lines = 0;
+    UINT8 bad = 0;
+    UINT8 first = 0;
+    bool same = true;
+
+    *fault = ROM_FAULT_NONE;
+
+    for (UINT32 offset = 1 ; (offset < region->length) && (lines < 16) ; offset <<= 1)
+    {
+        UINT16 data;
+
+        error = m_cpu->memoryRead(region->start + offset, &data);
+        if (FAILED(error))
+        {
+            return error;
+        }
+
+        if (lines == 0)
+        {
+            first = (UINT8) data;
+        }
+
+        same = same && ((UINT8) data == first);
+
+        if ((UINT8) data != (UINT8) region->data2n[lines])
+        {
+            bad++;
+        }
+
+        lines++;
+    }
+
+    if (bad == 0)
+    {
+        return error;
+    }
+
+    if (same)
+    {
+        *fault = ROM_FAULT_EMPTY;
+    }
+    else if (bad * 2 > lines)
+    {
+        *fault = ROM_FAULT_WRONG;
+    }
+    else
+    {
+        *fault = ROM_FAULT_SAMPLES;
+    }
+
+    return error;
+}
+
+//
+// OK: n ROMs         - every ROM passed (sampling and, if run, CRC).
+// OK: n sampled      - every ROM passed sampling, no CRC run.
+// E:8De 8Fw 8Jc +2   - the bad sockets with the ROM_FAULT_ of each, sampling failures first.
+//
+PERROR
+CRomVerify::verifySampled(
+    const ROM_REGION *romRegion,
+    bool             crcPassed
+)
+{
+    PERROR error = errorSuccess;
+    ROM_REGION region;
+    char fault[ROM_SCHEDULE_MAX_REGIONS];
+    char location[ROM_SCHEDULE_MAX_REGIONS][sizeof(region.location)];
+    UINT8 count = 0;
+    UINT8 shown = 0;
+
+    // Pass 1 - samples only, every socket.
+    {
+        CRomSchedule schedule(romRegion, m_bankSwitchContext);
+
+        error = schedule.check();
+        if (FAILED(error))
+        {
+            return error;
+        }
+
+        while (schedule.next(&region))
+        {
+            error = schedule.select(&region);
+            if (SUCCESS(error))
+            {
+                error = sampleRegion(&region, &fault[count]);
+            }
+            if (FAILED(error))
+            {
+                return error;
+            }
+
+            memcpy(location[count], region.location, sizeof(region.location));
+            count++;
+        }
+    }
+
+    // Pass 2 - a full CRC of the ROMs that sampled good, in the same order.
+    if (crcPassed)
+    {
+        CRomSchedule schedule(romRegion, m_bankSwitchContext);
+
+        for (UINT8 r = 0 ; schedule.next(&region) && (r < count) ; r++)
+        {
+            if (fault[r] != ROM_FAULT_NONE)
+            {
+                continue;
+            }
+
+            error = verifyRegion(&schedule, &region, (ROM_BLOCK_MAP *) NULL, false);
+            if (FAILED(error))
+            {
+                return error;
+            }
+
+            if (m_crc != region.crc)
+            {
+                fault[r] = ROM_FAULT_CRC;
+            }
+        }
+    }
+
+    error = errorCustom;
+    error->description = "E:";
+
+    // Sampling failures first - the dead and missing parts are the ones to see first.
+    for (UINT8 pass = 0 ; pass < 2 ; pass++)
+    {
+        for (UINT8 r = 0 ; r < count ; r++)
+        {
+            if ((fault[r] == ROM_FAULT_NONE) || ((fault[r] == ROM_FAULT_CRC) != (pass == 1)))
+            {
+                continue;
+            }
+
+            if (shown++ < 3)
+            {
+                if (shown > 1)
+                {
+                    error->description += " ";
+                }
+
+                for (UINT8 i = 0 ; (i < 3) && (location[r][i] != ' ') && (location[r][i] != 0) ; i++)
+                {
+                    error->description += location[r][i];
+                }
+
+                error->description += fault[r];
+            }
+        }
+    }
+
+    if (shown == 0)
+    {
+        error->code = ERROR_SUCCESS;
+        error->description = "OK: ";
+        error->description += String(count, DEC);
+        error->description += crcPassed ? " ROMs" : " sampled";
+    }
+    else
+    {
+        error->code = ERROR_FAILED;
+
+        if (shown > 3)
+        {
+            error->description += " +";
+            error->description += String(shown - 3, DEC);
+        }
+    }
+
+    return error;
+}
+
+//
+// OK:D1 X3A S7F - the ROM at D1 passed its CRC; its bytes XOR to 0x3A and sum to 0x7F.
+// E:D1 X3A S7F  - the same for a ROM that failed its CRC.
+//
+PERROR
+CRomVerify::checksum(
+    const ROM_REGION *romRegion,
+    UINT8            *rom
+)
+{
+    PERROR error = errorSuccess;
+    CRomSchedule schedule(romRegion, m_bankSwitchContext);
+    ROM_REGION region;
+    UINT8 count = 0;
+
+    while (pgm_read_dword(&romRegion[count].length) != 0)
+    {
+        count++;
+    }
+
+    if (count == 0)
+    {
+        return errorSuccess;
+    }
+
+    if (*rom >= count)
+    {
+        *rom = 0;
+    }
+
+    memcpy_P(&region, &romRegion[*rom], sizeof(region));
+
+    // The checksums come from the same pass as the CRC.
+    error = verifyRegion(&schedule, &region, (ROM_BLOCK_MAP *) NULL, false);
+    if (FAILED(error))
+    {
+        return error;
+    }
+
+    (*rom)++;
+
+    error = errorCustom;
+    error->code = (m_crc == region.crc) ? ERROR_SUCCESS : ERROR_FAILED;
+    error->description = (m_crc == region.crc) ? "OK:" : "E:";
+    error->description += region.location;
+    error->description += " X";
+    STRING_UINT8_HEX(error->description, m_stats.dataXor);
+    error->description += " S";
+    STRING_UINT8_HEX(error->description, m_stats.dataSum);
+
+    return error;
+}
+
+//
+// Read the slices of a chip in order into one running CRC.
+//
+PERROR
+CRomVerify::verifyChip(
+    const ROM_CHIP *chip
+)
+{
+    PERROR error = errorSuccess;
+    CRomStream stream(m_cpu);
+
+    stream.add(this);
+    stream.begin(chip->sliceLength * chip->slices);
+
+    for (UINT8 slice = 0 ; slice < chip->slices ; slice++)
+    {
+        if (chip->bankSwitch[slice] != NO_BANK_SWITCH)
+        {
+            error = chip->bankSwitch[slice](m_bankSwitchContext);
+            if (FAILED(error))
+            {
+                break;
+            }
+        }
+
+        error = stream.read(chip->start, chip->sliceLength);
+        if (FAILED(error))
+        {
+            break;
+        }
+    }
+
+    stream.end();
+
+    return error;
+}
+
+//
+// As reportBitError but the offset is in the chip, e.g. "E:8E +2123 D5 3E", so it
+// matches an offset in a dump of the part. The second pass reads the slices in order.
+//
+PERROR
+CRomVerify::reportChipBitError(
+    const ROM_CHIP *chip
+)
+{
+    PERROR error = errorSuccess;
+    UINT32 offset;
+    UINT8  bit;
+    UINT8  bad = 0;
+    UINT16 data;
+    UINT32 crc = CCrc32::c_init;
+
+    if (!CCrc32::findBitError(chip->crc, m_crc, chip->sliceLength * chip->slices, &offset, &bit))
+    {
+        return errorSuccess;
+    }
+
+    for (UINT8 slice = 0 ; slice < chip->slices ; slice++)
+    {
+        if (chip->bankSwitch[slice] != NO_BANK_SWITCH)
+        {
+            error = chip->bankSwitch[slice](m_bankSwitchContext);
+            if (FAILED(error))
+            {
+                return error;
+            }
+        }
+
+        for (UINT32 i = 0 ; i < chip->sliceLength ; i++)
+        {
+            error = m_cpu->memoryRead(chip->start + i, &data);
+            if (FAILED(error))
+            {
+                return error;
+            }
+
+            if ((slice * chip->sliceLength) + i == offset)
+            {
+                bad = (UINT8) data;
+                data ^= (1 << bit);
+            }
+
+            crc = CCrc32::update(crc, (UINT8) data);
+        }
+    }
+
+    if (CCrc32::final(crc) != chip->crc)
+    {
+        return errorSuccess;
+    }
+
+    error = errorCustom;
+    error->code = ERROR_FAILED;
+    error->description = "E:";
+    error->description += chip->location;
+    error->description += " +";
+    STRING_UINT32_HEX(error->description, offset);
+    error->description += " D";
+    error->description += String(bit, DEC);
+    error->description += " ";
+    STRING_UINT8_HEX(error->description, bad);
+
+    return error;
+}
+
+PERROR
+CRomVerify::verifyChips(
+    const ROM_CHIP *romChip
+)
+{
+    PERROR error = errorSuccess;
+    UINT8 count = 0;
+
+    for (UINT8 c = 0 ; ; c++)
+    {
+        ROM_CHIP      chip;
+        ROM_CRC_INDEX entry;
+
+        memcpy_P(&chip, &romChip[c], sizeof(chip));
+
+        if (chip.slices == 0)
+        {
+            break;
+        }
+
+        error = verifyChip(&chip);
+        if (FAILED(error))
+        {
+            return error;
+        }
+
+        if (m_crc == chip.crc)
+        {
+            count++;
+            continue;
+        }
+
+        // A good chip from another set, then a single flipped bit.
+        if (findCrc(m_crc, chip.location, &entry))
+        {
+            error = errorCustom;
+            reportKnownRom(error, chip.location, &entry);
+            return error;
+        }
+
+        error = reportChipBitError(&chip);
+        if (error != errorSuccess)
+        {
+            return error;
+        }
+
+        // The CRC to compare with a dump of the part.
+        error = errorCustom;
+        error->code = ERROR_FAILED;
+        error->description = "E:";
+        error->description += chip.location;
+        error->description += " CRC ";
+        STRING_UINT32_HEX(error->description, m_crc);
+        return error;
+    }
+
+    error = errorCustom;
+    error->code = ERROR_SUCCESS;
+    error->description = "OK: ";
+    error->description += String(count, DEC);
+    error->description += " chips";
+
+    return error;
+}
@@ -0,0 +1,201 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef CRomVerify_h
+#define CRomVerify_h
+
+#include "ICpu.h"
+#include "RomBlockMap.h"
+#include "RomCrcIndex.h"
+#include "CRomSchedule.h"
+#include "CCrc32.h"
+#include "CRomFault.h"
+#include "CRomStream.h"
+
+//
+// Per socket results of a sampled verify.
+//
+#define ROM_FAULT_NONE     ' '
+#define ROM_FAULT_EMPTY    'e'   // Every sample the same - empty socket, no part or dead /CE
+#define ROM_FAULT_WRONG    'w'   // Most samples wrong - wrong part or revision
+#define ROM_FAULT_SAMPLES  'a'   // Some samples wrong - address or data line
+#define ROM_FAULT_CRC      'c'   // Samples good, CRC bad - corrupt data
+
+//
+// A ROM only visible as slices through a bank switched window, checked as one chip
+// so its CRC32 is that of a dump of the part. Tables of these are PROGMEM and
+// terminated with {0}.
+//
+#define ROM_CHIP_MAX_SLICES 4
+
+typedef struct _ROM_CHIP {
+    UINT32             start;                          // CPU address of the window
+    UINT32             sliceLength;                    // Bytes in each slice
+    UINT8              slices;                         // Number of slices, 0 ends the list
+    BankSwitchCallback bankSwitch[ROM_CHIP_MAX_SLICES]; // Selects each slice, in chip order
+    UINT32             crc;                            // CRC32 of the whole chip
+    char               location[4];                    // "012"
+} ROM_CHIP;
+
+class CRomVerify : public IRomConsumer
+{
+    public:
+
+        CRomVerify(
+                   ICpu *cpu,
+                   void *bankSwitchContext
+        );
+
+        ~CRomVerify(
+        );
+
+        //
+        // Verify every ROM in the PROGMEM table against its block map.
+        // stopAtFirstBlock ends each ROM at its first bad block rather than mapping the whole ROM.
+        //
+        PERROR verify(
+                      const ROM_REGION *romRegion,
+                      bool             stopAtFirstBlock
+        );
+
+        //
+        // Read one ROM of the PROGMEM table and report its CRC result with the XOR and
+        // 8 bit sum of its bytes, as the game's own self-test shows them. rom selects
+        // the ROM and is moved on to the next so repeated calls step through the table.
+        //
+        PERROR checksum(
+                        const ROM_REGION *romRegion,
+                        UINT8            *rom
+        );
+
+        //
+        // Read the 2^n samples of every ROM in the PROGMEM table first to find missing,
+        // wrong or dead parts across the whole board in a few hundred reads, then (if
+        // crcPassed) CRC the ROMs that passed sampling. Every bad socket is reported.
+        //
+        PERROR verifySampled(
+                             const ROM_REGION *romRegion,
+                             bool             crcPassed
+        );
+
+        //
+        // Verify each chip of the PROGMEM table with one CRC across its slices.
+        //
+        PERROR verifyChips(
+                           const ROM_CHIP *romChip
+        );
+
+        //
+        // IRomConsumer - the CRC32, fault statistics and block map of a pass, so a
+        // verify can share its pass with other consumers (see CRomDump).
+        //
+        void begin(
+                   UINT32 length
+        );
+
+        bool consume(
+                     UINT32      offset,
+                     const UINT8 *data,
+                     UINT16      length
+        );
+
+        void end(
+        );
+
+        //
+        // The CRC32 of the last pass.
+        //
+        UINT32 crc(
+        );
+
+    private:
+
+        PERROR sampleRegion(
+                            const ROM_REGION *region,
+                            char             *fault
+        );
+
+        PERROR verifyChip(
+                          const ROM_CHIP *chip
+        );
+
+        PERROR reportChipBitError(
+                                  const ROM_CHIP *chip
+        );
+
+        PERROR verifyRegion(
+                            CRomSchedule        *schedule,
+                            const ROM_REGION    *region,
+                            const ROM_BLOCK_MAP *blockMap,
+                            bool                stopAtFirstBlock
+        );
+
+        static bool findBlockMap(
+                                 UINT32        crc,
+                                 ROM_BLOCK_MAP *blockMap
+        );
+
+        static bool findCrc(
+                            UINT32           crc,
+                            const char       *location,
+                            ROM_CRC_INDEX    *entry
+        );
+
+        static void reportKnownRom(
+                                   PERROR              error,
+                                   const char          *location,
+                                   const ROM_CRC_INDEX *entry
+        );
+
+        PERROR reportBitError(
+                              const ROM_REGION *region
+        );
+
+        bool isBadBlock(
+                        UINT16 block
+        );
+
+        void reportBlocks(
+                          PERROR           error,
+                          const ROM_REGION *region,
+                          UINT16           blocks
+        );
+
+        ICpu   *m_cpu;
+        void   *m_bankSwitchContext;
+
+        UINT8  m_badBlock[ROM_BLOCK_MAX / 8];
+        UINT16 m_badCount;
+        UINT16 m_firstBad;
+        UINT32 m_crc;
+        UINT32 m_blockCrc;
+        UINT32 m_length;
+
+        const ROM_BLOCK_MAP *m_blockMap;
+        bool                m_stopAtFirstBlock;
+
+        ROM_STATS m_stats;
+};
+
+#endif
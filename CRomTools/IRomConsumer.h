@@ -0,0 +1,64 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef IRomConsumer_h
+#define IRomConsumer_h
+
+#include "Types.h"
+
+//
+// Something that analyses or sends the bytes of a ROM as CRomStream reads them.
+// Every consumer of a stream sees the same bytes from the one bus pass.
+//
+class IRomConsumer
+{
+    public:
+
+        virtual ~IRomConsumer(
+        ) {}
+
+        //
+        // A pass over length bytes is starting.
+        //
+        virtual void begin(
+                           UINT32 length
+        ) = 0;
+
+        //
+        // The next length bytes, offset bytes into the pass.
+        // Return false to end the pass early.
+        //
+        virtual bool consume(
+                             UINT32      offset,
+                             const UINT8 *data,
+                             UINT16      length
+        ) = 0;
+
+        //
+        // The pass has finished, or ended early.
+        //
+        virtual void end(
+        ) = 0;
+};
+
+#endif
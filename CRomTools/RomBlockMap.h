@@ -0,0 +1,49 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef RomBlockMap_h
+#define RomBlockMap_h
+
+#include "Types.h"
+
+//
+// Per 256 byte block CRC32s of a known ROM image, used to pinpoint where a
+// failing ROM differs from the good image rather than only that it differs.
+//
+// The map is found by the CRC32 of the whole image so any game's ROM_REGION
+// can use it without a change to its tables. Tables of these are PROGMEM and
+// terminated with {0}. Build RomBlockMap.cpp from a rompath with extras/rom_block_map.cpp.
+//
+typedef struct _ROM_BLOCK_MAP {
+    UINT32       crc;       // CRC32 of the whole image (as in the ROM_REGION)
+    UINT32       length;    // Length of the image in bytes
+    const UINT32 *blockCrc; // PROGMEM CRC32 of each 256 byte block, length / 256 entries
+} ROM_BLOCK_MAP;
+
+#define ROM_BLOCK_SIZE   256
+#define ROM_BLOCK_MAX    256 // Up to 64KB images
+
+extern const ROM_BLOCK_MAP g_romBlockMap[];
+
+#endif
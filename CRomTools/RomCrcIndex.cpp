@@ -0,0 +1,181 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Generated by extras/rom_crc_index.sh - do not edit.
+//
+#include "RomCrcIndex.h"
+#include <avr/pgmspace.h>
+
+const ROM_CRC_INDEX g_romCrcIndex[] PROGMEM = {
+    {0x014E761F, "SInv SURD",  "5 D"},
+    {0x096ED35C, "Asteroid 2", "DE1"},
+    {0x0B7BFAA4, "Bzone 2",    "LM1"},
+    {0x0CC75459, "Asteroid 2", "F1 "},
+    {0x0DCC0BE6, "AstDlx 3",   "J1 "},
+    {0x0E147FF7, "ArmWrestle", "8K "},
+    {0x0E159534, "SInv SV2",   "r35"},
+    {0x0E8A75DF, "SInv SURD",  "7 B"},
+    {0x110E04FF, "Centiped 2", "E1 "},
+    {0x11392151, "SInv SURD",  "8 A"},
+    {0x1293B826, "SInv SV2",   "r31"},
+    {0x13DE36D5, "Bzone 2",    "E1 "},
+    {0x157A8516, "AstDlx 2",   "EF1"},
+    {0x15A6C068, "S.Punch B",  "8H "},
+    {0x1A11C805, "Namco",      "8F0"},
+    {0x1D595CE2, "PunchOut I", "8L "},
+    {0x1E14E919, "Bzone 2",    "N1 "},
+    {0x1FA629E8, "S.Punch B",  "8J "},
+    {0x25233192, "Asteroid 4", "DE1"},
+    {0x257E58EC, "JapOld Hi",  "8D "},
+    {0x2724E591, "LLander 2",  "C1 "},
+    {0x2AFF3140, "LLander 1",  "F1 "},
+    {0x2B895A90, "Pacland",    "8F "},
+    {0x2C68E0B4, "SInv SV2",   "r41"},
+    {0x2FFE3319, "Pacland",    "8J "},
+    {0x312CAA02, "Asteroid 4", "C1 "},
+    {0x33CE4640, "Centiped 4", "J1 "},
+    {0x355A9371, "LLander 2",  "R3"},
+    {0x3ABCB7CD, "Namco",      "8E1"},
+    {0x3B597407, "AstDlx 2",   "R2 "},
+    {0x3FE43BB5, "Midway",     "8D "},
+    {0x40711675, "Milliped 1", "MN1"},
+    {0x44E40FA4, "Centiped 3", "J1 "},
+    {0x464D170D, "Midway Hi",  "8D "},
+    {0x46752C7D, "Milliped 1", "H1 "},
+    {0x47CEDDC9, "Centiped 1", "E1 "},
+    {0x483E651E, "SInv SV2",   "r34"},
+    {0x48D453EF, "PunchOut I", "8J "},
+    {0x493E24B7, "LLander 1",  "DE1"},
+    {0x4C07FD3E, "Centiped 3", "E1 "},
+    {0x4C451E8A, "SpcDuel 1",  "NP1"},
+    {0x4C96E11C, "Japan",      "8B "},
+    {0x4DDA0854, "Namco Hi",   "8D "},
+    {0x4FF3CDD9, "S.Punch B",  "8F "},
+    {0x517D4DB8, "Namco",      "8F1"},
+    {0x5652710F, "SpcDuel 1",  "J1 "},
+    {0x567CA359, "Japan",      "8J1"},
+    {0x570B72EA, "Namco",      "8H0"},
+    {0x599C6B78, "SInv SURD",  "6 C"},
+    {0x5AB0D9DE, "Centiped 3", "D1 "},
+    {0x5C66EB6F, "Japan Old",  "8D "},
+    {0x5D8123D7, "PunchOut B", "8H "},
+    {0x5D9D9111, "Bzone 2",    "H1 "},
+    {0x5F8E80C3, "Midway HiR", "8D "},
+    {0x62E137E0, "Milliped 1", "JK1"},
+    {0x6644C92A, "Japan HiR",  "8B "},
+    {0x664A07C4, "ArmWrestle", "8F "},
+    {0x66D7B04A, "Centiped 4", "FH1"},
+    {0x674AB844, "Centiped 1", "D1 "},
+    {0x67F5AEDC, "PunchOut I", "8H "},
+    {0x68719B30, "SInv SU",    "r42"},
+    {0x691122FE, "SpcDuel 1",  "R7 "},
+    {0x6D720C41, "AstDlx 3",   "FH1"},
+    {0x703B9780, "S.Punch B",  "8L "},
+    {0x72837A4E, "LLander 2",  "B1 "},
+    {0x7414177B, "Bzone 2",    "BC3"},
+    {0x745ECF40, "PunchOut B", "8K "},
+    {0x761DE4F3, "PunchOut I", "8F "},
+    {0x77DA4B2F, "LLander 2",  "DE1"},
+    {0x7A7F870E, "PunchOut B", "8J "},
+    {0x7A9B4485, "SInv SU",    "r36"},
+    {0x7AF66200, "Pacland",    "8H "},
+    {0x7C86620D, "SInv SU",    "r35"},
+    {0x7D4E3D05, "Asteroid 1", "C1 "},
+    {0x7D511572, "AstDlx 3",   "NP2"},
+    {0x7ED251C6, "Japan HiR",  "8D "},
+    {0x7EE80952, "Centiped 1", "FH1"},
+    {0x872C56C0, "Namco",      "8H1"},
+    {0x8ABE2466, "SInv SU",    "r41"},
+    {0x8B71FD9E, "Asteroid 4", "NP3"},
+    {0x8CF5BD8D, "Japan",      "8D "},
+    {0x8EA8F939, "Bzone 2",    "A3 "},
+    {0x8EC9EAE2, "SInv SU",    "r31"},
+    {0x8F5DABC6, "AstDlx 2",   "D1 "},
+    {0x93999153, "Centiped 2", "J1 "},
+    {0x93B33DCE, "Centiped 1", "J1 "},
+    {0x9735EB5A, "PunchOut J", "8L "},
+    {0x98BABA41, "PunchOut J", "8K "},
+    {0x99699366, "Asteroid 1", "NP3"},
+    {0x99812147, "Japan Hi",   "8B "},
+    {0x9C4FFA68, "LLander 2",  "NP3"},
+    {0x9D628753, "SInv SURD",  "2 G"},
+    {0xA2118EEC, "ArmWrestle", "8H "},
+    {0xA4003ADC, "PunchOut B", "8L "},
+    {0xA4D7A525, "AstDlx 3",   "D1 "},
+    {0xA938AE99, "Midway",     "8B "},
+    {0xA9EFA48D, "Namco",      "8E0"},
+    {0xAA9FA739, "Pacland",    "8E "},
+    {0xAB55CBD2, "Bzone 2",    "J1 "},
+    {0xAD281297, "Bzone 2",    "K1 "},
+    {0xAF660BE5, "Namco",      "8J0"},
+    {0xB01E59A9, "Pacland J",  "8J "},
+    {0xB09764C1, "ArmWrestle", "8L "},
+    {0xB0EA7631, "Namco",      "8B "},
+    {0xB11A7D01, "LLander 1",  "B1 "},
+    {0xB2909E2F, "Centiped 2", "D1 "},
+    {0xB2F7DB47, "JapOld Hi",  "8B "},
+    {0xB503EAF7, "Asteroid 4", "F1 "},
+    {0xB635E8AC, "SInv SURD",  "4 E"},
+    {0xB8763EEA, "LLander 2",  "F1 "},
+    {0xBB8CABE1, "AstDlx 3",   "R2 "},
+    {0xBCDEBE1B, "Centiped 4", "E1 "},
+    {0xC062FA5C, "PunchOut I", "8K "},
+    {0xC4D995EB, "Centiped 4", "D1 "},
+    {0xC8A55DDB, "PunchOut B", "8F "},
+    {0xC99CC9E9, "Namco",      "8J1"},
+    {0xCC2EDB26, "Centiped 2", "FH1"},
+    {0xCCAF38F6, "SInv SU",    "r34"},
+    {0xCD239E6C, "SpcDuel 1",  "R1 "},
+    {0xCD80B13F, "SInv SV2",   "r42"},
+    {0xCE687182, "S.Punch J",  "8K "},
+    {0xD0C32D72, "SInv SV2",   "r36"},
+    {0xD15800B4, "Japan Hi",   "8D "},
+    {0xD4004AAE, "AstDlx 3",   "EF1"},
+    {0xD736C6FC, "JapOld HiR", "8D "},
+    {0xD8DB74E3, "AstDlx 2",   "J1 "},
+    {0xD8DD0461, "SpcDuel 1",  "NP7"},
+    {0xD903E84E, "Namco",      "8D "},
+    {0xDB342868, "SInv SURD",  "3 F"},
+    {0xDC2A592B, "S.Punch J",  "8L "},
+    {0xE13719F6, "S.Punch B",  "8K "},
+    {0xE41B38A3, "SpcDuel 1",  "KL1"},
+    {0xE53C28A9, "Asteroid 1", "DE1"},
+    {0xE7365289, "ArmWrestle", "8J "},
+    {0xE9BFDA64, "Asteroid 1", "F1 "},
+    {0xEA52CDA1, "PunchOut J", "8F "},
+    {0xEE72DA63, "SpcDuel 1",  "M1 "},
+    {0xEF09BAC7, "AstDlx 1",   "J1 "},
+    {0xEFBC3FA0, "Bzone 1",    "E1 "},
+    {0xF4037B6E, "SpcDuel 2",  "R1 "},
+    {0xF625F153, "SInv SURD",  "1 H"},
+    {0xF729FB94, "Japan Old",  "8B "},
+    {0xF745B5D5, "S.Punch J",  "8F "},
+    {0xFB01BAF2, "Milliped 1", "L1 "},
+    {0xFDEA913C, "AstDlx 2",   "FH1"},
+    {0xFF0B7D1D, "Namco HiR",  "8D "},
+    {0xFF69B424, "Centiped 3", "FH1"},
+    {0} // end of list
+};
+
+const UINT16 g_romCrcIndexCount = (sizeof(g_romCrcIndex) / sizeof(g_romCrcIndex[0])) - 1;
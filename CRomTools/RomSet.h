@@ -0,0 +1,52 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef RomSet_h
+#define RomSet_h
+
+#include "ICpu.h"
+
+//
+// The romsets of a game are built from their ROMs rather than copied table to table.
+//
+// Each ROM - its socket, 2^n samples and CRC - is written once as a macro named after
+// the part and each set's PROGMEM ROM_REGION table lists the parts it's made of:
+//
+//   #define CHP1_C_8L  {NO_BANK_SWITCH, s_ROM_ADDR_8L, s_ROM_2764_SIZE, s_romData_B_8L, 0xA4003ADC, "8L "}
+//   ...
+//   static const ROM_REGION s_romRegionSetB[] PROGMEM = {CHP1_C_8L, CHP1_C_8K, ..., {0}};
+//   static const ROM_REGION s_romRegionSetJ[] PROGMEM = {CHP1_C_8L_A, CHP1_C_8K_A, ..., {0}};
+//
+// so a variant says only which parts it changes. The tables stay flat arrays as CGame
+// and the ROM tools read them. Sets with identical CPU ROMs share one table.
+//
+
+//
+// Fail the build if a set's table isn't count ROMs and the end of list - e.g. a table
+// initialised from another table, which compiles to one entry or none.
+//
+#define ROM_SET_CHECK(romRegion, count) \
+    static_assert((sizeof(romRegion) / sizeof(ROM_REGION)) == ((count) + 1), \
+                  #romRegion " is not a full set")
+
+#endif
@@ -92,20 +92,31 @@ static const OUTPUT_REGION s_outputRegion[] PROGMEM = {
 //
 // Custom functions implemented for this game.
 //
-static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = { //                                    "0123456789"
-                                                    
+static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = { //                                                  "0123456789"
+                                                            {CPunchOutBaseGame::romTest<ROM_TEST_IDENTIFY>,     "ROM Ident "},
+                                                            {CPunchOutBaseGame::romTest<ROM_TEST_VERIFY>,       "ROM BlkMap"},
+                                                            {CPunchOutBaseGame::romTest<ROM_TEST_VERIFY_FIRST>, "ROM Blk1st"},
+                                                            {CPunchOutBaseGame::romTest<ROM_TEST_SAMPLE>,       "ROM Sample"},
+                                                            {CPunchOutBaseGame::romTest<ROM_TEST_QUICK>,        "ROM Quick "},
+                                                            {CPunchOutBaseGame::romTest<ROM_TEST_DUMP>,         "ROM Dump  "},
+                                                            {CPunchOutBaseGame::romTest<ROM_TEST_COMPARE>,      "ROM Comp  "},
+                                                            {CPunchOutBaseGame::romTest<ROM_TEST_LEARN>,        "ROM Learn "},
+                                                            {CPunchOutBaseGame::romTest<ROM_TEST_LAYOUT>,       "ROM Layout"},
+                                                            {CCrc32::benchmark,                                 "CRC Bench "},
                                                             {NO_CUSTOM_FUNCTION}}; // end of list
 
 
 CPunchOutBaseGame::CPunchOutBaseGame(
-    const ROM_REGION    *romRegion
+    const ROM_REGION    *romRegion,
+    const ROM_SET       *romSet
 ) : CGame( romRegion,
            s_ramRegion,
            s_ramRegionByteOnly,
            s_ramRegionWriteOnly,
            s_inputRegion,
            s_outputRegion,
-           s_customFunction)
+           s_customFunction),
+    m_romSet(romSet)
 {
     m_cpu = new CZ80Cpu();
     m_cpu->idle();
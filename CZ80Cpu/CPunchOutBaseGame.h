@@ -26,6 +26,7 @@
 #define CPunchOutBaseGame_h
 
 #include "CGame.h"
+#include "CRomTests.h"
 
 
 class CPunchOutBaseGame : public CGame
@@ -39,15 +40,31 @@ class CPunchOutBaseGame : public CGame
         virtual PERROR interruptCheck(
         );
 
+        // ROM tools - see CRomTests.h
+        template <ROM_TEST test>
+        static PERROR romTest(
+            void *cPunchOutBaseGame
+        )
+        {
+            CPunchOutBaseGame *pThis = (CPunchOutBaseGame *) cPunchOutBaseGame;
+
+            return CRomTests::run(test, pThis->m_cpu, pThis, pThis->m_romRegion, pThis->m_romSet, (const ROM_CHIP *) NULL);
+        }
+
     protected:
 
         CPunchOutBaseGame(
-            const ROM_REGION *romRegion
+            const ROM_REGION *romRegion,
+            const ROM_SET    *romSet
         );
 
         ~CPunchOutBaseGame(
         );
 
+    private:
+
+        const ROM_SET *m_romSet;
+
 };
 
 #endif
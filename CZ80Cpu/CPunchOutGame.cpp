@@ -76,80 +76,104 @@ static const UINT32 s_ROM_ADDR_8H =  0x6000;
 static const UINT32 s_ROM_ADDR_8F =  0x8000;
 
 //
-// Set B from MAME - 'punchout'
+// Each ROM once - see RomSet.h. Named after the MAME part.
 //
-static const ROM_REGION s_romRegionSetB[] PROGMEM = {
-    {NO_BANK_SWITCH, s_ROM_ADDR_8L, s_ROM_2764_SIZE,  s_romData_B_8L,  0xA4003ADC, "8L "}, // chp1-c.8l
-    {NO_BANK_SWITCH, s_ROM_ADDR_8K, s_ROM_2764_SIZE,  s_romData_B_8K,  0x745ECF40, "8K "}, // chp1-c.8k
-    {NO_BANK_SWITCH, s_ROM_ADDR_8J, s_ROM_2764_SIZE,  s_romData_B_8J,  0x7A7F870E, "8J "}, // chp1-c.8j
-    {NO_BANK_SWITCH, s_ROM_ADDR_8H, s_ROM_2764_SIZE,  s_romData_B_8H,  0x5D8123D7, "8H "}, // chp1-c.8h
-    {NO_BANK_SWITCH, s_ROM_ADDR_8F, s_ROM_27128_SIZE, s_romData_B_8F,  0xC8A55DDB, "8F "}, // chp1-c.8f
-	{0} }; // end of list
+#define CHP1_C_8L       {NO_BANK_SWITCH, s_ROM_ADDR_8L, s_ROM_2764_SIZE,  s_romData_B_8L,   0xA4003ADC, "8L "} // chp1-c.8l
+#define CHP1_C_8K       {NO_BANK_SWITCH, s_ROM_ADDR_8K, s_ROM_2764_SIZE,  s_romData_B_8K,   0x745ECF40, "8K "} // chp1-c.8k
+#define CHP1_C_8J       {NO_BANK_SWITCH, s_ROM_ADDR_8J, s_ROM_2764_SIZE,  s_romData_B_8J,   0x7A7F870E, "8J "} // chp1-c.8j
+#define CHP1_C_8H       {NO_BANK_SWITCH, s_ROM_ADDR_8H, s_ROM_2764_SIZE,  s_romData_B_8H,   0x5D8123D7, "8H "} // chp1-c.8h
+#define CHP1_C_8F       {NO_BANK_SWITCH, s_ROM_ADDR_8F, s_ROM_27128_SIZE, s_romData_B_8F,   0xC8A55DDB, "8F "} // chp1-c.8f
+
+#define CHP1_C_8L_A     {NO_BANK_SWITCH, s_ROM_ADDR_8L, s_ROM_2764_SIZE,  s_romData_J_8L,   0x9735EB5A, "8L "} // chp1-c_8l_a.8l
+#define CHP1_C_8K_A     {NO_BANK_SWITCH, s_ROM_ADDR_8K, s_ROM_2764_SIZE,  s_romData_J_8K,   0x98BABA41, "8K "} // chp1-c_8k_a.8k
+#define CHP1_C_8F_A     {NO_BANK_SWITCH, s_ROM_ADDR_8F, s_ROM_27128_SIZE, s_romData_J_8F,   0xEA52CDA1, "8F "} // chp1-c_8f_a.8f
+
+#define PUNCHITA_8L     {NO_BANK_SWITCH, s_ROM_ADDR_8L, s_ROM_2764_SIZE,  s_romData_I_8L,   0x1D595CE2, "8L "} // chp1-c.8l
+#define PUNCHITA_8K     {NO_BANK_SWITCH, s_ROM_ADDR_8K, s_ROM_2764_SIZE,  s_romData_I_8K,   0xC062FA5C, "8K "} // chp1-c.8k
+#define PUNCHITA_8J     {NO_BANK_SWITCH, s_ROM_ADDR_8J, s_ROM_2764_SIZE,  s_romData_I_8J,   0x48D453EF, "8J "} // chp1-c.8j
+#define PUNCHITA_8H     {NO_BANK_SWITCH, s_ROM_ADDR_8H, s_ROM_2764_SIZE,  s_romData_I_8H,   0x67F5AEDC, "8H "} // chp1-c.8h
+#define PUNCHITA_8F     {NO_BANK_SWITCH, s_ROM_ADDR_8F, s_ROM_27128_SIZE, s_romData_I_8F,   0x761DE4F3, "8F "} // chp1-c.8f
+
+#define CHS1_C_8L       {NO_BANK_SWITCH, s_ROM_ADDR_8L, s_ROM_2764_SIZE,  s_romData_S_8L,   0x703B9780, "8L "} // chs1-c.8l
+#define CHS1_C_8K       {NO_BANK_SWITCH, s_ROM_ADDR_8K, s_ROM_2764_SIZE,  s_romData_S_8K,   0xE13719F6, "8K "} // chs1-c.8k
+#define CHS1_C_8J       {NO_BANK_SWITCH, s_ROM_ADDR_8J, s_ROM_2764_SIZE,  s_romData_S_8J,   0x1FA629E8, "8J "} // chs1-c.8j
+#define CHS1_C_8H       {NO_BANK_SWITCH, s_ROM_ADDR_8H, s_ROM_2764_SIZE,  s_romData_S_8H,   0x15A6C068, "8H "} // chs1-c.8h
+#define CHS1_C_8F       {NO_BANK_SWITCH, s_ROM_ADDR_8F, s_ROM_27128_SIZE, s_romData_S_8F,   0x4FF3CDD9, "8F "} // chs1-c.8f
+
+#define CHS1C8LA        {NO_BANK_SWITCH, s_ROM_ADDR_8L, s_ROM_2764_SIZE,  s_romData_SJ_8L,  0xDC2A592B, "8L "} // chs1c8la.bin
+#define CHS1C8KA        {NO_BANK_SWITCH, s_ROM_ADDR_8K, s_ROM_2764_SIZE,  s_romData_SJ_8K,  0xCE687182, "8K "} // chs1c8ka.bin
+#define CHS1C8FA        {NO_BANK_SWITCH, s_ROM_ADDR_8F, s_ROM_27128_SIZE, s_romData_SJ_8F,  0xF745B5D5, "8F "} // chs1c8fa.bin
+
+#define CHV1_C_8L       {NO_BANK_SWITCH, s_ROM_ADDR_8L, s_ROM_2764_SIZE,  s_romData_AR_8L,  0xB09764C1, "8L "} // chv1-c.8l
+#define CHV1_C_8K       {NO_BANK_SWITCH, s_ROM_ADDR_8K, s_ROM_2764_SIZE,  s_romData_AR_8K,  0x0E147FF7, "8K "} // chv1-c.8k
+#define CHV1_C_8J       {NO_BANK_SWITCH, s_ROM_ADDR_8J, s_ROM_2764_SIZE,  s_romData_AR_8J,  0xE7365289, "8J "} // chv1-c.8j
+#define CHV1_C_8H       {NO_BANK_SWITCH, s_ROM_ADDR_8H, s_ROM_2764_SIZE,  s_romData_AR_8H,  0xA2118EEC, "8H "} // chv1-c.8h
+#define CHPV_C_8F       {NO_BANK_SWITCH, s_ROM_ADDR_8F, s_ROM_27128_SIZE, s_romData_AR_8F,  0x664A07C4, "8F "} // chpv-c.8f
+
+static const UINT8 s_ROM_COUNT = 5;
 
 //
-// Set A from MAME - 'punchouta'
+// Set B from MAME - 'punchout'
+// Set A from MAME - 'punchouta' - listed with the same CPU ROMs as set B so it uses this table.
 //
-static const ROM_REGION s_romRegionSetA[] PROGMEM = *s_romRegionSetB;
+static const ROM_REGION s_romRegionSetB[] PROGMEM = {
+    CHP1_C_8L, CHP1_C_8K, CHP1_C_8J, CHP1_C_8H, CHP1_C_8F,
+    {0} }; // end of list
+ROM_SET_CHECK(s_romRegionSetB, s_ROM_COUNT);
 
 //
-// Set J from MAME - 'punchout J' - Japanese
+// Set J from MAME - 'punchout J' - Japanese - 8J and 8H as set B
 //
 static const ROM_REGION s_romRegionSetJ[] PROGMEM = {
-    {NO_BANK_SWITCH, s_ROM_ADDR_8L, s_ROM_2764_SIZE,  s_romData_J_8L,  0x9735EB5A, "8L "}, // chp1-c_8l_a.8l
-    {NO_BANK_SWITCH, s_ROM_ADDR_8K, s_ROM_2764_SIZE,  s_romData_J_8K,  0x98BABA41, "8K "}, // chp1-c_8k_a.8k
-    {NO_BANK_SWITCH, s_ROM_ADDR_8J, s_ROM_2764_SIZE,  s_romData_B_8J,  0x7A7F870E, "8J "}, // chp1-c.8j
-    {NO_BANK_SWITCH, s_ROM_ADDR_8H, s_ROM_2764_SIZE,  s_romData_B_8H,  0x5D8123D7, "8H "}, // chp1-c.8h
-    {NO_BANK_SWITCH, s_ROM_ADDR_8F, s_ROM_27128_SIZE, s_romData_J_8F,  0xEA52CDA1, "8F "}, // chp1-c_8f_a.8f
-	{0} }; // end of list
+    CHP1_C_8L_A, CHP1_C_8K_A, CHP1_C_8J, CHP1_C_8H, CHP1_C_8F_A,
+    {0} }; // end of list
+ROM_SET_CHECK(s_romRegionSetJ, s_ROM_COUNT);
 
 //
 // Set I from MAME - 'punchita' - Italian boot
 //
 static const ROM_REGION s_romRegionSetI[] PROGMEM = {
-    {NO_BANK_SWITCH, s_ROM_ADDR_8L, s_ROM_2764_SIZE,  s_romData_I_8L,  0x1D595CE2, "8L "}, // chp1-c.8l
-    {NO_BANK_SWITCH, s_ROM_ADDR_8K, s_ROM_2764_SIZE,  s_romData_I_8K,  0xC062FA5C, "8K "}, // chp1-c.8k
-    {NO_BANK_SWITCH, s_ROM_ADDR_8J, s_ROM_2764_SIZE,  s_romData_I_8J,  0x48D453EF, "8J "}, // chp1-c.8j
-    {NO_BANK_SWITCH, s_ROM_ADDR_8H, s_ROM_2764_SIZE,  s_romData_I_8H,  0x67F5AEDC, "8H "}, // chp1-c.8h
-    {NO_BANK_SWITCH, s_ROM_ADDR_8F, s_ROM_27128_SIZE, s_romData_I_8F,  0x761DE4F3, "8F "}, // chp1-c.8f
-	{0} }; // end of list
+    PUNCHITA_8L, PUNCHITA_8K, PUNCHITA_8J, PUNCHITA_8H, PUNCHITA_8F,
+    {0} }; // end of list
+ROM_SET_CHECK(s_romRegionSetI, s_ROM_COUNT);
 
 //
 // Set S from MAME - 'spnchout' - Super Punch-Out!!!
+// Set SA from MAME - 'spnchouta' - listed with the same CPU ROMs as set S so it uses this table.
 //
 static const ROM_REGION s_romRegionSetS[] PROGMEM = {
-    {NO_BANK_SWITCH, s_ROM_ADDR_8L, s_ROM_2764_SIZE,  s_romData_S_8L,  0x703B9780, "8L "}, // chs1-c.8l
-    {NO_BANK_SWITCH, s_ROM_ADDR_8K, s_ROM_2764_SIZE,  s_romData_S_8K,  0xE13719F6, "8K "}, // chs1-c.8k
-    {NO_BANK_SWITCH, s_ROM_ADDR_8J, s_ROM_2764_SIZE,  s_romData_S_8J,  0x1FA629E8, "8J "}, // chs1-c.8j
-    {NO_BANK_SWITCH, s_ROM_ADDR_8H, s_ROM_2764_SIZE,  s_romData_S_8H,  0x15A6C068, "8H "}, // chs1-c.8h
-    {NO_BANK_SWITCH, s_ROM_ADDR_8F, s_ROM_27128_SIZE, s_romData_S_8F,  0x4FF3CDD9, "8F "}, // chs1-c.8f
-	{0} }; // end of list
-
-//
-// Set SA from MAME - 'spnchouta'
-//
-static const ROM_REGION s_romRegionSetSA[] PROGMEM = *s_romRegionSetS;
+    CHS1_C_8L, CHS1_C_8K, CHS1_C_8J, CHS1_C_8H, CHS1_C_8F,
+    {0} }; // end of list
+ROM_SET_CHECK(s_romRegionSetS, s_ROM_COUNT);
 
 //
-// Set SJ from MAME - 'spnchoutj' - Japanese
+// Set SJ from MAME - 'spnchoutj' - Japanese - 8J and 8H as set S
 //
 static const ROM_REGION s_romRegionSetSJ[] PROGMEM = {
-    {NO_BANK_SWITCH, s_ROM_ADDR_8L, s_ROM_2764_SIZE,  s_romData_SJ_8L,  0xDC2A592B, "8L "}, // chs1c8la.bin
-    {NO_BANK_SWITCH, s_ROM_ADDR_8K, s_ROM_2764_SIZE,  s_romData_SJ_8K,  0xCE687182, "8K "}, // chs1c8ka.bin
-    {NO_BANK_SWITCH, s_ROM_ADDR_8J, s_ROM_2764_SIZE,  s_romData_S_8J,   0x1FA629E8, "8J "}, // chs1-c.8j
-    {NO_BANK_SWITCH, s_ROM_ADDR_8H, s_ROM_2764_SIZE,  s_romData_S_8H,   0x15A6C068, "8H "}, // chs1-c.8h
-    {NO_BANK_SWITCH, s_ROM_ADDR_8F, s_ROM_27128_SIZE, s_romData_SJ_8F,  0xF745B5D5, "8F "}, // chs1c8fa.bin
-	{0} }; // end of list
+    CHS1C8LA, CHS1C8KA, CHS1_C_8J, CHS1_C_8H, CHS1C8FA,
+    {0} }; // end of list
+ROM_SET_CHECK(s_romRegionSetSJ, s_ROM_COUNT);
 
 //
 // Set AR from MAME - 'armwrest' - Arm Wrestling
 //
 static const ROM_REGION s_romRegionSetAR[] PROGMEM = {
-    {NO_BANK_SWITCH, s_ROM_ADDR_8L, s_ROM_2764_SIZE,  s_romData_AR_8L,  0xB09764C1, "8L "}, // chv1-c.8l
-    {NO_BANK_SWITCH, s_ROM_ADDR_8K, s_ROM_2764_SIZE,  s_romData_AR_8K,  0x0E147FF7, "8K "}, // chv1-c.8k
-    {NO_BANK_SWITCH, s_ROM_ADDR_8J, s_ROM_2764_SIZE,  s_romData_AR_8J,  0xE7365289, "8J "}, // chv1-c.8j
-    {NO_BANK_SWITCH, s_ROM_ADDR_8H, s_ROM_2764_SIZE,  s_romData_AR_8H,  0xA2118EEC, "8H "}, // chv1-c.8h
-    {NO_BANK_SWITCH, s_ROM_ADDR_8F, s_ROM_27128_SIZE, s_romData_AR_8F,  0x664A07C4, "8F "}, // chpv-c.8f
-	{0} }; // end of list
+    CHV1_C_8L, CHV1_C_8K, CHV1_C_8J, CHV1_C_8H, CHPV_C_8F,
+    {0} }; // end of list
+ROM_SET_CHECK(s_romRegionSetAR, s_ROM_COUNT);
+
+//
+// All the distinct sets above - used to identify the installed set from the 2^n data samples.
+// Punch-Out!! and Super Punch-Out!! share a board so they are identified together.
+//
+static const ROM_SET s_romSet[] PROGMEM = { //"0123456789"
+    {s_romRegionSetB,   "PunchOut B"},
+    {s_romRegionSetJ,   "PunchOut J"},
+    {s_romRegionSetI,   "PunchOut I"},
+    {s_romRegionSetS,   "S.Punch B "},
+    {s_romRegionSetSJ,  "S.Punch J "},
+    {s_romRegionSetAR,  "ArmWrestle"},
+    {0} }; // end of list
 
 
 //
@@ -181,7 +205,7 @@ IGame*
 CPunchOutGame::createInstanceSetA(
 )
 {
-    return (new CPunchOutGame(s_romRegionSetA));
+    return (new CPunchOutGame(s_romRegionSetB));
 }
 
 IGame*
@@ -209,7 +233,7 @@ IGame*
 CPunchOutGame::createInstanceSetSA(
 )
 {
-    return (new CPunchOutGame(s_romRegionSetSA));
+    return (new CPunchOutGame(s_romRegionSetS));
 }
 
 IGame*
@@ -228,7 +252,7 @@ CPunchOutGame::createInstanceSetAR(
 
 CPunchOutGame::CPunchOutGame(
     const ROM_REGION *romRegion
-) : CPunchOutBaseGame( romRegion )
+) : CPunchOutBaseGame( romRegion, s_romSet )
 {
 }
 
@@ -26,6 +26,7 @@
 #define CPunchOutGame_h
 
 #include "CPunchOutBaseGame.h"
+#include "RomSet.h"
 
 class CPunchOutGame : public CPunchOutBaseGame
 {
@@ -0,0 +1,366 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef RomCrc32_h
+#define RomCrc32_h
+
+//
+// Host CRC32 (IEEE 802.3, reflected, polynomial 0xEDB88320 - the CRC of MAME, zip and
+// CRomTools/CCrc32) for the tools in extras.
+//
+// Kernels, all giving the same result:
+//   bitwise  - one shift and conditional XOR per bit, as CCrc32::updateBitwise on the ICT.
+//              The reference the others are checked against (rom_crc_bench).
+//   slice16  - slicing-by-16, 16 x 1KB tables, 16 bytes per step. Portable.
+//   pclmul   - x86-64 carry-less multiply folding, 64 bytes per step. Picked at run time
+//              when the CPU has PCLMULQDQ and SSE4.1.
+//   armv8    - the ARMv8 CRC32 instructions, 8 bytes per step. Built when the compiler
+//              targets them (-march=armv8-a+crc, and by default for Apple silicon).
+//
+// romCrc32() uses the fastest kernel the host has.
+//
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ROM_CRC32_HAVE_PCLMUL 1
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#define ROM_CRC32_HAVE_ARMV8 1
+#include <arm_acle.h>
+#endif
+
+typedef enum _ROM_CRC32_KERNEL {
+    ROM_CRC32_BITWISE = 0,
+    ROM_CRC32_SLICE16,
+    ROM_CRC32_PCLMUL,
+    ROM_CRC32_ARMV8,
+    ROM_CRC32_KERNELS
+} ROM_CRC32_KERNEL;
+
+static const uint32_t c_romCrc32Polynomial = 0xEDB88320;
+
+//
+// The slicing tables - [0] is the byte table, [k] advances it by k more zero bytes.
+//
+typedef struct _ROM_CRC32_TABLES {
+    uint32_t table[16][256];
+
+    _ROM_CRC32_TABLES()
+    {
+        for (uint32_t i = 0 ; i < 256 ; i++)
+        {
+            uint32_t c = i;
+
+            for (int bit = 0 ; bit < 8 ; bit++)
+            {
+                c = (c & 1) ? ((c >> 1) ^ c_romCrc32Polynomial) : (c >> 1);
+            }
+
+            table[0][i] = c;
+        }
+
+        for (int k = 1 ; k < 16 ; k++)
+        {
+            for (uint32_t i = 0 ; i < 256 ; i++)
+            {
+                table[k][i] = (table[k - 1][i] >> 8) ^ table[0][table[k - 1][i] & 0xFF];
+            }
+        }
+    }
+} ROM_CRC32_TABLES;
+
+static inline const ROM_CRC32_TABLES &
+romCrc32Tables(
+)
+{
+    static const ROM_CRC32_TABLES tables;
+
+    return tables;
+}
+
+//
+// The update functions take and return the raw register - start with 0xFFFFFFFF and
+// invert at the end, as romCrc32() does.
+//
+static inline uint32_t
+romCrc32Bitwise(
+    uint32_t      crc,
+    const uint8_t *data,
+    size_t        length
+)
+{
+    for (size_t i = 0 ; i < length ; i++)
+    {
+        crc ^= data[i];
+
+        for (int bit = 0 ; bit < 8 ; bit++)
+        {
+            if (crc & 1)
+            {
+                crc = (crc >> 1) ^ c_romCrc32Polynomial;
+            }
+            else
+            {
+                crc = (crc >> 1);
+            }
+        }
+    }
+
+    return crc;
+}
+
+static inline uint32_t
+romCrc32Load(
+    const uint8_t *data
+)
+{
+    uint32_t value;
+
+    memcpy(&value, data, sizeof(value));
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    value = __builtin_bswap32(value);
+#endif
+
+    return value;
+}
+
+static inline uint32_t
+romCrc32Slice16(
+    uint32_t      crc,
+    const uint8_t *data,
+    size_t        length
+)
+{
+    const uint32_t (*t)[256] = romCrc32Tables().table;
+
+    for ( ; length >= 16 ; data += 16, length -= 16)
+    {
+        uint32_t a = romCrc32Load(data) ^ crc;
+        uint32_t b = romCrc32Load(data + 4);
+        uint32_t c = romCrc32Load(data + 8);
+        uint32_t d = romCrc32Load(data + 12);
+
+        crc = t[15][a & 0xFF] ^ t[14][(a >> 8) & 0xFF] ^ t[13][(a >> 16) & 0xFF] ^ t[12][a >> 24] ^
+              t[11][b & 0xFF] ^ t[10][(b >> 8) & 0xFF] ^ t[9][(b >> 16) & 0xFF]  ^ t[8][b >> 24]  ^
+              t[7][c & 0xFF]  ^ t[6][(c >> 8) & 0xFF]  ^ t[5][(c >> 16) & 0xFF]  ^ t[4][c >> 24]  ^
+              t[3][d & 0xFF]  ^ t[2][(d >> 8) & 0xFF]  ^ t[1][(d >> 16) & 0xFF]  ^ t[0][d >> 24];
+    }
+
+    for ( ; length > 0 ; data++, length--)
+    {
+        crc = t[0][(crc ^ *data) & 0xFF] ^ (crc >> 8);
+    }
+
+    return crc;
+}
+
+#ifdef ROM_CRC32_HAVE_PCLMUL
+
+//
+// Fold 64 bytes at a time into four 128 bit lanes with the x^(512+64) and x^512 mod P
+// constants, fold the lanes together with x^(128+64) and x^128, then reduce 128 -> 64
+// -> 32 bits and finish with a Barrett reduction (Intel, "Fast CRC Computation for
+// Generic Polynomials Using PCLMULQDQ", constants bit reflected for 0xEDB88320).
+//
+__attribute__((target("pclmul,sse4.1")))
+static inline uint32_t
+romCrc32Pclmul(
+    uint32_t      crc,
+    const uint8_t *data,
+    size_t        length
+)
+{
+    if (length < 64)
+    {
+        return romCrc32Slice16(crc, data, length);
+    }
+
+    const __m128i k1k2   = _mm_set_epi64x(0x01c6e41596LL, 0x0154442bd4LL);
+    const __m128i k3k4   = _mm_set_epi64x(0x00ccaa009eLL, 0x01751997d0LL);
+    const __m128i k5     = _mm_set_epi64x(0, 0x0163cd6124LL);
+    const __m128i poly   = _mm_set_epi64x(0x01f7011641LL, 0x01db710641LL);
+    const __m128i mask32 = _mm_set_epi32(0, 0, 0, -1);
+
+    __m128i x1 = _mm_loadu_si128((const __m128i *) (data + 0));
+    __m128i x2 = _mm_loadu_si128((const __m128i *) (data + 16));
+    __m128i x3 = _mm_loadu_si128((const __m128i *) (data + 32));
+    __m128i x4 = _mm_loadu_si128((const __m128i *) (data + 48));
+
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int) crc));
+
+    data   += 64;
+    length -= 64;
+
+    for ( ; length >= 64 ; data += 64, length -= 64)
+    {
+        __m128i h1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+        __m128i h2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+        __m128i h3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+        __m128i h4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k1k2, 0x00), h1), _mm_loadu_si128((const __m128i *) (data + 0)));
+        x2 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x2, k1k2, 0x00), h2), _mm_loadu_si128((const __m128i *) (data + 16)));
+        x3 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x3, k1k2, 0x00), h3), _mm_loadu_si128((const __m128i *) (data + 32)));
+        x4 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x4, k1k2, 0x00), h4), _mm_loadu_si128((const __m128i *) (data + 48)));
+    }
+
+    //
+    // Four lanes into one, then any remaining whole 16 byte blocks.
+    //
+    x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x00), _mm_clmulepi64_si128(x1, k3k4, 0x11)), x2);
+    x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x00), _mm_clmulepi64_si128(x1, k3k4, 0x11)), x3);
+    x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x00), _mm_clmulepi64_si128(x1, k3k4, 0x11)), x4);
+
+    for ( ; length >= 16 ; data += 16, length -= 16)
+    {
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x00), _mm_clmulepi64_si128(x1, k3k4, 0x11)),
+                           _mm_loadu_si128((const __m128i *) data));
+    }
+
+    //
+    // 128 -> 64 bits (appending 32 zero bits), 64 -> 32, then Barrett.
+    //
+    x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k5, 0x00);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 4), x2);
+
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x10);
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask32), poly, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    crc = (uint32_t) _mm_extract_epi32(x1, 1);
+
+    return romCrc32Slice16(crc, data, length);
+}
+
+#endif
+
+#ifdef ROM_CRC32_HAVE_ARMV8
+
+static inline uint32_t
+romCrc32Armv8(
+    uint32_t      crc,
+    const uint8_t *data,
+    size_t        length
+)
+{
+    for ( ; length >= 8 ; data += 8, length -= 8)
+    {
+        uint64_t value;
+
+        memcpy(&value, data, sizeof(value));
+        crc = __crc32d(crc, value);
+    }
+
+    for ( ; length > 0 ; data++, length--)
+    {
+        crc = __crc32b(crc, *data);
+    }
+
+    return crc;
+}
+
+#endif
+
+static inline bool
+romCrc32Available(
+    ROM_CRC32_KERNEL kernel
+)
+{
+    switch (kernel)
+    {
+        case ROM_CRC32_BITWISE :
+        case ROM_CRC32_SLICE16 : return true;
+#ifdef ROM_CRC32_HAVE_PCLMUL
+        case ROM_CRC32_PCLMUL  : return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+#endif
+#ifdef ROM_CRC32_HAVE_ARMV8
+        case ROM_CRC32_ARMV8   : return true;
+#endif
+        default                : return false;
+    }
+}
+
+static inline const char *
+romCrc32KernelName(
+    ROM_CRC32_KERNEL kernel
+)
+{
+    static const char *names[ROM_CRC32_KERNELS] = {"bitwise", "slice16", "pclmul", "armv8"};
+
+    return (kernel < ROM_CRC32_KERNELS) ? names[kernel] : "?";
+}
+
+//
+// Raw update with a given kernel - it must be available.
+//
+static inline uint32_t
+romCrc32Update(
+    ROM_CRC32_KERNEL kernel,
+    uint32_t         crc,
+    const uint8_t    *data,
+    size_t           length
+)
+{
+    switch (kernel)
+    {
+        case ROM_CRC32_BITWISE : return romCrc32Bitwise(crc, data, length);
+#ifdef ROM_CRC32_HAVE_PCLMUL
+        case ROM_CRC32_PCLMUL  : return romCrc32Pclmul(crc, data, length);
+#endif
+#ifdef ROM_CRC32_HAVE_ARMV8
+        case ROM_CRC32_ARMV8   : return romCrc32Armv8(crc, data, length);
+#endif
+        default                : return romCrc32Slice16(crc, data, length);
+    }
+}
+
+static inline ROM_CRC32_KERNEL
+romCrc32BestKernel(
+)
+{
+    static const ROM_CRC32_KERNEL best = romCrc32Available(ROM_CRC32_PCLMUL) ? ROM_CRC32_PCLMUL :
+                                         romCrc32Available(ROM_CRC32_ARMV8)  ? ROM_CRC32_ARMV8  :
+                                                                               ROM_CRC32_SLICE16;
+
+    return best;
+}
+
+static inline uint32_t
+romCrc32(
+    const uint8_t *data,
+    size_t        length
+)
+{
+    return romCrc32Update(romCrc32BestKernel(), 0xFFFFFFFF, data, length) ^ 0xFFFFFFFF;
+}
+
+#endif
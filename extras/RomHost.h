@@ -0,0 +1,546 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef RomHost_h
+#define RomHost_h
+
+//
+// Helpers shared by the host ROM tools in extras - CRC32 (RomCrc32.h), 2^n sample
+// count, mapped image files, romset directory listings, reading C sources and
+// printing ROM_REGION tables. POSIX only (Linux and macOS).
+//
+
+#include "RomCrc32.h"
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ctype.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//
+// A ROM image mapped read only.
+//
+typedef struct _ROM_FILE {
+    std::string   path;
+    const uint8_t *data;
+    size_t        size;
+} ROM_FILE;
+
+//
+// One sample per address line - the same count as the ICT's 2^n test.
+//
+static inline unsigned
+romSampleCount(
+    uint32_t length
+)
+{
+    unsigned count = 0;
+
+    for (uint32_t y = length - 1 ; y > 0 ; y >>= 1)
+    {
+        count++;
+    }
+
+    return count;
+}
+
+static inline std::string
+romBaseName(
+    const std::string &path
+)
+{
+    size_t slash = path.find_last_of('/');
+
+    return (slash == std::string::npos) ? path : path.substr(slash + 1);
+}
+
+static inline bool
+romIsDirectory(
+    const std::string &path
+)
+{
+    struct stat st;
+
+    return (stat(path.c_str(), &st) == 0) && S_ISDIR(st.st_mode);
+}
+
+//
+// Sorted paths of the files in a directory, descending into sub-directories
+// (a MAME rompath holds one directory per set) when recurse is set.
+//
+static inline void
+romListDirectory(
+    const std::string        &path,
+    bool                     recurse,
+    std::vector<std::string> *files
+)
+{
+    std::vector<std::string> found;
+    DIR *dir = opendir(path.c_str());
+    struct dirent *entry;
+
+    if (dir == NULL)
+    {
+        perror(path.c_str());
+        return;
+    }
+
+    while ((entry = readdir(dir)) != NULL)
+    {
+        if (entry->d_name[0] != '.')
+        {
+            found.push_back(path + "/" + entry->d_name);
+        }
+    }
+
+    closedir(dir);
+
+    std::sort(found.begin(), found.end());
+
+    for (size_t i = 0 ; i < found.size() ; i++)
+    {
+        if (romIsDirectory(found[i]))
+        {
+            if (recurse)
+            {
+                romListDirectory(found[i], recurse, files);
+            }
+        }
+        else
+        {
+            files->push_back(found[i]);
+        }
+    }
+}
+
+//
+// Map an image. Empty files and anything that isn't a regular file are skipped.
+//
+static inline bool
+romMapFile(
+    const std::string &path,
+    ROM_FILE          *file
+)
+{
+    struct stat st;
+    int fd = open(path.c_str(), O_RDONLY);
+
+    file->path = path;
+    file->data = NULL;
+    file->size = 0;
+
+    if (fd < 0)
+    {
+        perror(path.c_str());
+        return false;
+    }
+
+    if ((fstat(fd, &st) != 0) || !S_ISREG(st.st_mode) || (st.st_size == 0))
+    {
+        close(fd);
+        return false;
+    }
+
+    void *map = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    close(fd);
+
+    if (map == MAP_FAILED)
+    {
+        perror(path.c_str());
+        return false;
+    }
+
+    file->data = (const uint8_t *) map;
+    file->size = (size_t) st.st_size;
+
+    return true;
+}
+
+static inline void
+romUnmapFile(
+    ROM_FILE *file
+)
+{
+    if (file->data != NULL)
+    {
+        munmap((void *) file->data, file->size);
+        file->data = NULL;
+    }
+}
+
+static inline std::string
+romTrim(
+    const std::string &text
+)
+{
+    size_t first = text.find_first_not_of(" \t\r\n");
+    size_t last  = text.find_last_not_of(" \t\r\n");
+
+    return (first == std::string::npos) ? std::string() : text.substr(first, last - first + 1);
+}
+
+static inline bool
+romIsIdentifier(
+    char c
+)
+{
+    return isalnum((unsigned char) c) || (c == '_');
+}
+
+static inline bool
+romReadText(
+    const std::string &path,
+    std::string       *text
+)
+{
+    FILE *fp = fopen(path.c_str(), "rb");
+    char buffer[4096];
+    size_t count;
+
+    if (fp == NULL)
+    {
+        return false;
+    }
+
+    while ((count = fread(buffer, 1, sizeof(buffer), fp)) > 0)
+    {
+        text->append(buffer, count);
+    }
+
+    fclose(fp);
+
+    return true;
+}
+
+//
+// Comments become spaces (newlines kept) so that nothing else moves.
+//
+static inline std::string
+romStripComments(
+    const std::string &text
+)
+{
+    std::string out(text);
+
+    for (size_t i = 0 ; i < out.size() ; i++)
+    {
+        if (out[i] == '"')
+        {
+            for (i++ ; (i < out.size()) && (out[i] != '"') ; i++)
+            {
+                i += (out[i] == '\\') ? 1 : 0;
+            }
+        }
+        else if (out.compare(i, 2, "//") == 0)
+        {
+            for ( ; (i < out.size()) && (out[i] != '\n') ; i++)
+            {
+                out[i] = ' ';
+            }
+        }
+        else if (out.compare(i, 2, "/*") == 0)
+        {
+            size_t end = out.find("*/", i + 2);
+
+            end = (end == std::string::npos) ? out.size() : end + 2;
+
+            for ( ; i < end ; i++)
+            {
+                out[i] = (out[i] == '\n') ? '\n' : ' ';
+            }
+
+            i--;
+        }
+    }
+
+    return out;
+}
+
+//
+// Split macro arguments or initialiser fields on the commas that aren't inside
+// brackets, braces or a string.
+//
+static inline std::vector<std::string>
+romSplitArguments(
+    const std::string &text
+)
+{
+    std::vector<std::string> parts;
+    std::string part;
+    int depth = 0;
+    bool quoted = false;
+
+    for (size_t i = 0 ; i < text.size() ; i++)
+    {
+        char c = text[i];
+
+        if (c == '"')
+        {
+            quoted = !quoted;
+        }
+        else if (!quoted && ((c == '(') || (c == '{') || (c == '[')))
+        {
+            depth++;
+        }
+        else if (!quoted && ((c == ')') || (c == '}') || (c == ']')))
+        {
+            depth--;
+        }
+        else if (!quoted && (depth == 0) && (c == ','))
+        {
+            parts.push_back(romTrim(part));
+            part.clear();
+            continue;
+        }
+
+        part += c;
+    }
+
+    if (!romTrim(part).empty())
+    {
+        parts.push_back(romTrim(part));
+    }
+
+    return parts;
+}
+
+//
+// One ROM_REGION entry to print - a whole image or a slice of one.
+//
+typedef struct _ROM_ENTRY {
+    std::string           file;       // Image it came from
+    std::string           name;       // Suffix of s_romData_<name>
+    std::string           location;   // 3 character socket
+    std::string           bankSwitch; // Callback or NO_BANK_SWITCH
+    uint32_t              start;      // CPU address of the ROM
+    const uint8_t         *data;      // Mapped image data for this entry
+    uint32_t              length;
+    uint32_t              crc;
+    std::vector<uint8_t>  data2n;
+} ROM_ENTRY;
+
+//
+// pl5_01b.8b -> PL5_01B_8B
+//
+static inline std::string
+romCName(
+    const std::string &file
+)
+{
+    std::string name;
+
+    for (size_t i = 0 ; i < file.size() ; i++)
+    {
+        name += isalnum((unsigned char) file[i]) ? (char) toupper((unsigned char) file[i]) : '_';
+    }
+
+    return name;
+}
+
+//
+// pl5_01b.8b -> "8B " - blank if the extension isn't a plausible socket.
+//
+static inline std::string
+romMameLocation(
+    const std::string &file
+)
+{
+    size_t dot = file.find_last_of('.');
+    std::string location;
+
+    if ((dot != std::string::npos) && (file.size() - dot - 1 <= 3))
+    {
+        for (size_t i = dot + 1 ; i < file.size() ; i++)
+        {
+            location += (char) toupper((unsigned char) file[i]);
+        }
+    }
+
+    location.resize(3, ' ');
+
+    return location;
+}
+
+//
+// Add an image as one entry named s_romData_<name>, or cut it into window sized slices that each appear at
+// windowStart when their bank is selected - named _Lo/_Hi (or _0, _1...), with the slice
+// number as the socket's third character and bankSwitch's %s replaced by socket and slice.
+// A window of 0 keeps the image whole. banked puts even an image of one window or less in
+// the window as one slice - it's outside the CPU's address space otherwise.
+//
+static inline void
+romAddEntries(
+    const std::string      &file,
+    const std::string      &name,
+    const uint8_t          *data,
+    uint32_t               size,
+    const std::string      &location,
+    uint32_t               start,
+    uint32_t               window,
+    uint32_t               windowStart,
+    const std::string      &bankSwitch,
+    bool                   banked,
+    std::vector<ROM_ENTRY> *entries
+)
+{
+    uint32_t slices = ((window != 0) && (size > window)) ? ((size + window - 1) / window) : 1;
+    bool sliced = (slices > 1) || (banked && (window != 0));
+
+    for (uint32_t s = 0 ; s < slices ; s++)
+    {
+        ROM_ENTRY entry;
+
+        entry.file       = file;
+        entry.name       = name;
+        entry.location   = location;
+        entry.bankSwitch = "NO_BANK_SWITCH";
+        entry.start      = start;
+        entry.data       = data;
+        entry.length     = size;
+        entry.crc        = 0;
+
+        if (sliced)
+        {
+            std::string slice = (slices == 2) ? (s == 0 ? "Lo" : "Hi") : std::to_string(s);
+            std::string socket = location.substr(0, location.find(' '));
+            size_t at = bankSwitch.find("%s");
+
+            entry.name       += "_" + slice;
+            entry.location    = socket.substr(0, 2) + std::to_string(s);
+            entry.location.resize(3, ' ');
+            entry.start       = windowStart;
+            entry.data       += s * window;
+            entry.length      = std::min(window, size - s * window);
+
+            entry.bankSwitch = bankSwitch;
+
+            if (at != std::string::npos)
+            {
+                entry.bankSwitch.replace(at, 2, socket + "_" + slice);
+            }
+        }
+
+        entries->push_back(entry);
+    }
+}
+
+//
+// CRCs and samples of every entry, on every core.
+//
+static inline void
+romComputeEntries(
+    std::vector<ROM_ENTRY> *entries
+)
+{
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (unsigned t = 0 ; t < std::min<size_t>(threads, entries->size()) ; t++)
+    {
+        workers.push_back(std::thread([entries, &next]()
+        {
+            for (size_t e = next++ ; e < entries->size() ; e = next++)
+            {
+                ROM_ENTRY &entry = (*entries)[e];
+
+                entry.crc = romCrc32(entry.data, entry.length);
+
+                for (unsigned i = 0 ; i < romSampleCount(entry.length) ; i++)
+                {
+                    entry.data2n.push_back(entry.data[1UL << i]);
+                }
+            }
+        }));
+    }
+
+    for (size_t t = 0 ; t < workers.size() ; t++)
+    {
+        workers[t].join();
+    }
+}
+
+//
+// The sample arrays, then the table - in the form the games declare them.
+//
+static inline void
+romPrintTable(
+    const std::vector<ROM_ENTRY> &entries,
+    const std::string            &table
+)
+{
+    size_t nameWidth = 0;
+
+    for (size_t e = 0 ; e < entries.size() ; e++)
+    {
+        nameWidth = std::max(nameWidth, entries[e].name.size());
+    }
+
+    for (size_t e = 0 ; e < entries.size() ; e++)
+    {
+        const ROM_ENTRY &entry = entries[e];
+        std::string array = "s_romData_" + entry.name + "[]";
+
+        printf("static const UINT16 %-*s = {", (int) (nameWidth + 12), array.c_str());
+
+        for (size_t i = 0 ; i < entry.data2n.size() ; i++)
+        {
+            printf("%s0x%02x", (i == 0) ? "" : ",", entry.data2n[i]);
+        }
+
+        printf("}; //0x%08X\n", entry.crc);
+    }
+
+    printf("\nstatic const ROM_REGION %s[] PROGMEM = { //\n", table.c_str());
+
+    for (size_t e = 0 ; e < entries.size() ; e++)
+    {
+        const ROM_ENTRY &entry = entries[e];
+        std::string array = "s_romData_" + entry.name + ",";
+
+        printf("    {%s, 0x%04X, 0x%04X, %-*s 0x%08X, \"%s\"}, //%s\n",
+               entry.bankSwitch.c_str(),
+               entry.start,
+               entry.length,
+               (int) (nameWidth + 11),
+               array.c_str(),
+               entry.crc,
+               entry.location.c_str(),
+               entry.file.c_str());
+    }
+
+    printf("    {0} }; // end of list\n");
+}
+
+#endif
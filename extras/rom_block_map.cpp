@@ -0,0 +1,306 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+//
+// Host tool - builds CRomTools/RomBlockMap.cpp, the per 256 byte block CRC32s of every ROM
+// in the games' tables that can be found in a rompath. Run from the repository root:
+//
+//   g++ -std=c++11 -O2 -pthread -o rom_block_map extras/rom_block_map.cpp
+//
+//   rom_block_map <rompath | image> ... > CRomTools/RomBlockMap.cpp
+//
+// The ROMs wanted are those of CRomTools/RomCrcIndex.cpp (see rom_crc_index.sh). Each image
+// in a rompath is matched by its CRC32, whole or as an aligned slice (e.g. a Pacland bank of
+// an 8E-8J chip), so an unzipped MAME rompath gives the maps of every romset it holds. An
+// image named on the command line is mapped even if no table lists it. The ROMs of the
+// index that weren't found are listed on stderr.
+//
+// Every image is read once and cut into blocks in memory - nothing is forked per block.
+//
+
+#include "RomHost.h"
+
+#include <map>
+
+#include <stdlib.h>
+#include <string.h>
+
+static const char *c_index  = "CRomTools/RomCrcIndex.cpp";
+static const char *c_header = "CRomTools/RomBlockMap.h";
+
+static const uint32_t c_blockSize = 256;
+static const uint32_t c_maxLength = 0x10000; // ROM_BLOCK_MAX blocks
+static const uint32_t c_minSlice  = 0x400;
+
+//
+// An image or slice that is wanted, and the name it's shown with.
+//
+typedef struct _ROM_MAPPED {
+    const uint8_t *data;
+    uint32_t      length;
+    std::string   source;
+} ROM_MAPPED;
+
+//
+// The CRCs of the index, each with the first set and socket that uses it.
+//
+static bool
+readIndex(
+    std::map<uint32_t, std::string> *wanted
+)
+{
+    std::string text;
+    size_t at = 0;
+
+    if (!romReadText(c_index, &text))
+    {
+        return false;
+    }
+
+    while ((at = text.find("{0x", at)) != std::string::npos)
+    {
+        size_t end = text.find('}', at);
+        uint32_t crc = (uint32_t) strtoul(text.c_str() + at + 1, NULL, 16);
+        std::string row = text.substr(at, end - at);
+        std::string name;
+
+        size_t q1 = row.find('"');
+        size_t q2 = row.find('"', q1 + 1);
+        size_t q3 = row.find('"', q2 + 1);
+        size_t q4 = row.find('"', q3 + 1);
+
+        if (q4 != std::string::npos)
+        {
+            name = romTrim(row.substr(q1 + 1, q2 - q1 - 1)) + " " + romTrim(row.substr(q3 + 1, q4 - q3 - 1));
+        }
+
+        if (wanted->find(crc) == wanted->end())
+        {
+            (*wanted)[crc] = name;
+        }
+
+        at = end;
+    }
+
+    return true;
+}
+
+//
+// The whole image and each of its aligned power of 2 slices.
+//
+static void
+matchImage(
+    const ROM_FILE                        &file,
+    bool                                  named,
+    const std::map<uint32_t, std::string> &wanted,
+    std::map<uint32_t, ROM_MAPPED>        *found
+)
+{
+    std::string base = romBaseName(file.path);
+
+    for (uint32_t length = (uint32_t) file.size ; (length == file.size) || (length >= c_minSlice) ; length /= 2)
+    {
+        for (uint32_t offset = 0 ; offset + length <= file.size ; offset += length)
+        {
+            uint32_t crc;
+            char source[64];
+
+            if (length > c_maxLength)
+            {
+                continue;
+            }
+
+            crc = romCrc32(file.data + offset, length);
+
+            bool whole = (length == file.size);
+
+            if (((wanted.find(crc) == wanted.end()) && !(named && whole)) || (found->find(crc) != found->end()))
+            {
+                continue;
+            }
+
+            if (whole)
+            {
+                snprintf(source, sizeof(source), "%s", base.c_str());
+            }
+            else
+            {
+                snprintf(source, sizeof(source), "%s 0x%04X-0x%04X", base.c_str(), offset, offset + length - 1);
+            }
+
+            ROM_MAPPED mapped;
+
+            mapped.data   = file.data + offset;
+            mapped.length = length;
+            mapped.source = source;
+
+            (*found)[crc] = mapped;
+        }
+
+        // Only power of 2 slices of a power of 2 image.
+        if ((length & (length - 1)) != 0)
+        {
+            break;
+        }
+    }
+}
+
+static void
+printMaps(
+    const std::map<uint32_t, std::string> &wanted,
+    const std::map<uint32_t, ROM_MAPPED>  &found
+)
+{
+    std::string header;
+    std::map<uint32_t, ROM_MAPPED>::const_iterator i;
+
+    // Copyright header from the map header - its leading comment block, license and all
+    if (romReadText(c_header, &header))
+    {
+        size_t end = 0;
+
+        while (header.compare(end, 2, "//") == 0)
+        {
+            size_t next = header.find('\n', end);
+
+            end = (next == std::string::npos) ? header.size() : next + 1;
+        }
+
+        fwrite(header.data(), 1, end, stdout);
+    }
+
+    printf("// Generated by extras/rom_block_map.cpp - do not edit.\n//\n");
+    printf("#include \"RomBlockMap.h\"\n#include <avr/pgmspace.h>\n");
+
+    for (i = found.begin() ; i != found.end() ; ++i)
+    {
+        const ROM_MAPPED &mapped = i->second;
+        uint32_t blocks = (mapped.length + c_blockSize - 1) / c_blockSize;
+        std::map<uint32_t, std::string>::const_iterator name = wanted.find(i->first);
+
+        printf("\n// %s%s%s\n", mapped.source.c_str(),
+               (name == wanted.end()) ? "" : " - ",
+               (name == wanted.end()) ? "" : name->second.c_str());
+        printf("static const UINT32 s_blocks_%08X[] PROGMEM = {\n", i->first);
+
+        for (uint32_t b = 0 ; b < blocks ; b++)
+        {
+            uint32_t size = std::min(c_blockSize, mapped.length - b * c_blockSize);
+
+            printf("%s0x%08X%s", ((b % 8) == 0) ? "    " : "",
+                   romCrc32(mapped.data + b * c_blockSize, size),
+                   (b + 1 == blocks) ? "\n" : (((b % 8) == 7) ? ",\n" : ", "));
+        }
+
+        printf("};\n");
+    }
+
+    printf("\nconst ROM_BLOCK_MAP g_romBlockMap[] PROGMEM = {\n");
+
+    for (i = found.begin() ; i != found.end() ; ++i)
+    {
+        printf("    {0x%08X, 0x%04X, s_blocks_%08X},\n", i->first, i->second.length, i->first);
+    }
+
+    printf("    {0} // end of list\n};\n");
+}
+
+static void
+usage(
+)
+{
+    fprintf(stderr, "Usage: rom_block_map <rompath | image> ... > CRomTools/RomBlockMap.cpp\n");
+    exit(1);
+}
+
+int
+main(
+    int  argc,
+    char *argv[]
+)
+{
+    std::map<uint32_t, std::string> wanted;
+    std::map<uint32_t, ROM_MAPPED> found;
+    std::vector<ROM_FILE> files;
+
+    if (argc < 2)
+    {
+        usage();
+    }
+
+    if (!readIndex(&wanted))
+    {
+        fprintf(stderr, "%s not found - run from the repository root\n", c_index);
+        return 1;
+    }
+
+    for (int a = 1 ; a < argc ; a++)
+    {
+        std::vector<std::string> paths;
+        bool named = !romIsDirectory(argv[a]);
+
+        if (named)
+        {
+            paths.push_back(argv[a]);
+        }
+        else
+        {
+            romListDirectory(argv[a], true, &paths);
+        }
+
+        for (size_t p = 0 ; p < paths.size() ; p++)
+        {
+            ROM_FILE file;
+
+            if (romMapFile(paths[p], &file))
+            {
+                files.push_back(file);
+                matchImage(file, named, wanted, &found);
+            }
+        }
+    }
+
+    printMaps(wanted, found);
+
+    unsigned missing = 0;
+
+    for (std::map<uint32_t, std::string>::const_iterator w = wanted.begin() ; w != wanted.end() ; ++w)
+    {
+        if (found.find(w->first) == found.end())
+        {
+            fprintf(stderr, "not found: %08X %s\n", w->first, w->second.c_str());
+            missing++;
+        }
+    }
+
+    fprintf(stderr, "%u block maps, %u ROMs of the index not found\n", (unsigned) found.size(), missing);
+
+    for (size_t f = 0 ; f < files.size() ; f++)
+    {
+        romUnmapFile(&files[f]);
+    }
+
+    return 0;
+}
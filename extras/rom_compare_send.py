@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+
+# Sends a reference image to the ICT's 'ROM Comp' (see CRomTools/CRomCompare.h) so a
+# ROM with no entry in the game's table can be checked byte for byte against it. The
+# image is sent a chunk at a time as the ICT reads the ROM; the mismatches are printed
+# at the end.
+#
+# Needs pyserial. Start this first, then run 'ROM Comp' on the ICT - opening the port
+# can reset the Mega so it's opened once and left open.
+#
+#   rom_compare_send.py <port> <image> <socket>        e.g. /dev/ttyACM0 hack.8d 8D
+#   rom_compare_send.py <port> <image> @<address>      e.g. /dev/ttyACM0 hack.bin @6000
+
+import struct
+import sys
+import zlib
+
+import serial
+
+SYNC = 0xA5
+CHUNK_SIZE = 16
+BAUD = 1000000
+TIMEOUT = 5
+
+
+class LinkTimeout(Exception):
+    pass
+
+
+def read_exact(port, count):
+    data = b''
+    while len(data) < count:
+        read = port.read(count - len(data))
+        if not read:
+            raise LinkTimeout()
+        data += read
+    return data
+
+
+def read_frame(port):
+    while read_exact(port, 1)[0] != SYNC:
+        pass
+
+    head = read_exact(port, 3)
+    length = struct.unpack('<H', head[1:3])[0]
+    payload = read_exact(port, length)
+    crc = struct.unpack('<I', read_exact(port, 4))[0]
+
+    if zlib.crc32(head + payload) != crc:
+        return None, None
+
+    return chr(head[0]), payload
+
+
+def send_frame(port, kind, payload):
+    body = kind.encode() + struct.pack('<H', len(payload)) + payload
+    port.write(bytes([SYNC]) + body + struct.pack('<I', zlib.crc32(body)))
+
+
+def main():
+    if len(sys.argv) < 4:
+        print("Usage: rom_compare_send.py <port> <image> <socket | @address>")
+        sys.exit(1)
+
+    with open(sys.argv[2], 'rb') as f:
+        image = f.read()
+
+    if sys.argv[3].startswith('@'):
+        location = b'\0\0\0\0'
+        start = int(sys.argv[3][1:], 16)
+    else:
+        location = sys.argv[3].encode()[:3].ljust(4, b'\0')
+        start = 0
+
+    port = serial.Serial(sys.argv[1], BAUD, dsrdtr=False, rtscts=False, timeout=TIMEOUT)
+
+    print("Waiting for ROM Comp...")
+
+    # No timeout here - 'ROM Comp' is started on the ICT after this.
+    while True:
+        try:
+            if read_frame(port)[0] == 'W':
+                break
+        except LinkTimeout:
+            pass
+
+    try:
+        compare(port, image, location, start)
+    except LinkTimeout:
+        print("The ICT stopped answering - link error (see the ICT display), compare again")
+        sys.exit(1)
+
+
+def compare(port, image, location, start):
+    send_frame(port, 'I', location + struct.pack('<III', start, len(image), zlib.crc32(image)))
+
+    kind, payload = read_frame(port)
+    if kind != 'S' or struct.unpack('<I', payload)[0] == 0:
+        print("Refused - no such socket or the image isn't its size (see the ICT display)")
+        sys.exit(1)
+
+    # One chunk for each request byte - the ICT sends nothing else until the image is done.
+    sent = 0
+    while sent < len(image):
+        read_exact(port, 1)
+        port.write(image[sent:sent + CHUNK_SIZE])
+        sent += CHUNK_SIZE
+
+    kind, payload = read_frame(port)
+    if kind != 'M':
+        print("Bad result frame")
+        sys.exit(1)
+
+    count, rom_crc, link = struct.unpack('<IIB', payload[:9])
+
+    if not link:
+        print("Link error - the image didn't arrive intact, compare again")
+        sys.exit(1)
+
+    print("ROM CRC32 %08X, image CRC32 %08X, %d bytes differ" % (rom_crc, zlib.crc32(image), count))
+
+    for i in range(9, len(payload), 6):
+        offset, expected, actual = struct.unpack('<IBB', payload[i:i + 6])
+        print("  +%04X  image %02X  ROM %02X  (bits %02X)" % (offset, expected, actual, expected ^ actual))
+
+    if count > (len(payload) - 9) // 6:
+        print("  ...")
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,222 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// Host tool - checks every CRC32 kernel of RomCrc32.h against the bitwise kernel the ICT
+// uses and reports the throughput of each, and with a rompath the time to read it against
+// the time to CRC it:
+//
+//   g++ -std=c++11 -O2 -pthread -o rom_crc_bench extras/rom_crc_bench.cpp
+//
+//   rom_crc_bench [rompath]
+//
+// Exits 1 if any kernel disagrees with the bitwise kernel.
+//
+
+#include "RomHost.h"
+
+#include <chrono>
+
+#include <stdlib.h>
+
+static const size_t c_benchSize = 64 * 1024 * 1024;
+
+static double
+seconds(
+    std::chrono::steady_clock::time_point begin
+)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+//
+// Every length to 4K at every alignment in a 16 byte line, a few large buffers and the
+// standard check value.
+//
+static bool
+validate(
+    ROM_CRC32_KERNEL kernel
+)
+{
+    std::vector<uint8_t> buffer(c_benchSize / 16 + 16);
+
+    for (size_t i = 0 ; i < buffer.size() ; i++)
+    {
+        buffer[i] = (uint8_t) rand();
+    }
+
+    if ((romCrc32Update(kernel, 0xFFFFFFFF, (const uint8_t *) "123456789", 9) ^ 0xFFFFFFFF) != 0xCBF43926)
+    {
+        printf("%-8s fails the check value\n", romCrc32KernelName(kernel));
+        return false;
+    }
+
+    for (size_t offset = 0 ; offset < 16 ; offset++)
+    {
+        for (size_t length = 0 ; length <= 4096 ; length++)
+        {
+            if (romCrc32Update(kernel, 0xFFFFFFFF, &buffer[offset], length) !=
+                romCrc32Bitwise(0xFFFFFFFF, &buffer[offset], length))
+            {
+                printf("%-8s differs at offset %u length %u\n", romCrc32KernelName(kernel), (unsigned) offset, (unsigned) length);
+                return false;
+            }
+        }
+    }
+
+    for (size_t length = 65536 ; length < buffer.size() ; length = length * 3 + 7)
+    {
+        //
+        // Split in two to check that updates chain.
+        //
+        uint32_t crc = romCrc32Update(kernel, 0xFFFFFFFF, &buffer[1], length / 3);
+
+        crc = romCrc32Update(kernel, crc, &buffer[1 + length / 3], length - length / 3);
+
+        if (crc != romCrc32Bitwise(0xFFFFFFFF, &buffer[1], length))
+        {
+            printf("%-8s differs at length %u\n", romCrc32KernelName(kernel), (unsigned) length);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static double
+throughput(
+    ROM_CRC32_KERNEL           kernel,
+    const std::vector<uint8_t> &buffer
+)
+{
+    size_t length = (kernel == ROM_CRC32_BITWISE) ? buffer.size() / 16 : buffer.size();
+    double best = 0;
+    volatile uint32_t sink = 0;
+
+    for (int run = 0 ; run < 5 ; run++)
+    {
+        std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+        sink = sink + romCrc32Update(kernel, 0xFFFFFFFF, buffer.data(), length);
+
+        best = std::max(best, length / seconds(begin) / 1e9);
+    }
+
+    return best;
+}
+
+//
+// Read the rompath as the tools do (map and touch each page), then CRC it.
+//
+static void
+rompath(
+    const char *path
+)
+{
+    std::vector<std::string> paths;
+    std::vector<ROM_FILE> files;
+    size_t total = 0;
+    volatile uint8_t sink = 0;
+
+    romListDirectory(path, true, &paths);
+
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+    for (size_t p = 0 ; p < paths.size() ; p++)
+    {
+        ROM_FILE file;
+
+        if (romMapFile(paths[p], &file))
+        {
+            for (size_t i = 0 ; i < file.size ; i += 4096)
+            {
+                sink = sink + file.data[i];
+            }
+
+            total += file.size;
+            files.push_back(file);
+        }
+    }
+
+    double read = seconds(begin);
+
+    begin = std::chrono::steady_clock::now();
+
+    for (size_t f = 0 ; f < files.size() ; f++)
+    {
+        sink = sink + (uint8_t) romCrc32(files[f].data, files[f].size);
+    }
+
+    double crc = seconds(begin);
+
+    printf("\n%s: %u files, %.1f MB\n", path, (unsigned) files.size(), total / 1e6);
+    printf("  read %8.2f ms\n", read * 1e3);
+    printf("  CRC  %8.2f ms (%s)\n", crc * 1e3, romCrc32KernelName(romCrc32BestKernel()));
+
+    for (size_t f = 0 ; f < files.size() ; f++)
+    {
+        romUnmapFile(&files[f]);
+    }
+}
+
+int
+main(
+    int  argc,
+    char *argv[]
+)
+{
+    std::vector<uint8_t> buffer(c_benchSize);
+    bool valid = true;
+
+    for (size_t i = 0 ; i < buffer.size() ; i++)
+    {
+        buffer[i] = (uint8_t) (i * 2654435761u >> 13);
+    }
+
+    printf("kernel   check  GB/s\n");
+
+    for (int k = 0 ; k < ROM_CRC32_KERNELS ; k++)
+    {
+        ROM_CRC32_KERNEL kernel = (ROM_CRC32_KERNEL) k;
+
+        if (!romCrc32Available(kernel))
+        {
+            printf("%-8s -\n", romCrc32KernelName(kernel));
+            continue;
+        }
+
+        bool ok = validate(kernel);
+
+        valid = valid && ok;
+        printf("%-8s %-6s %5.2f%s\n", romCrc32KernelName(kernel), ok ? "ok" : "FAIL", throughput(kernel, buffer),
+               (kernel == romCrc32BestKernel()) ? "  <- used" : "");
+    }
+
+    if (argc > 1)
+    {
+        rompath(argv[1]);
+    }
+
+    return valid ? 0 : 1;
+}
@@ -0,0 +1,151 @@
+#!/bin/bash
+
+# Builds CRomTools/RomCrcIndex.cpp - every ROM in the games' ROM_REGION and ROM_CHIP tables sorted by CRC32.
+# Run from the repository root after adding or changing a romset:
+#
+#   extras/rom_crc_index.sh > CRomTools/RomCrcIndex.cpp
+
+HEADER=CRomTools/RomCrcIndex.h
+
+test -f "$HEADER" || { echo "Run from the repository root!"; exit 1; }
+
+# Short game names - 10 characters including the set
+function game_name {
+    case "$1" in
+        CAsteroidsGame)           echo "Asteroid" ;;
+        CAsteroidsDeluxeGame)     echo "AstDlx" ;;
+        CBattlezoneGame)          echo "Bzone" ;;
+        CCentipedeGame)           echo "Centiped" ;;
+        CLunarLanderGame)         echo "LLander" ;;
+        CMillipedeGame)           echo "Milliped" ;;
+        CSpaceDuelGame)           echo "SpcDuel" ;;
+        CPaclandGame)             echo "Pacland" ;;
+        CMidwaySpaceInvadersGame) echo "SInv" ;;
+        CPunchOutGame)            echo "PunchOut" ;;
+        *)                        echo "${1:1:8}" ;;
+    esac
+}
+
+#Copyright header from the index header - its leading comment block, license and all
+awk '!/^\/\//{exit} 1' "$HEADER"
+printf '// Generated by extras/rom_crc_index.sh - do not edit.\n//\n'
+printf '#include "RomCrcIndex.h"\n#include <avr/pgmspace.h>\n\n'
+printf 'const ROM_CRC_INDEX g_romCrcIndex[] PROGMEM = {\n'
+
+for f in C*Cpu/C*Game.cpp
+do
+	GAME=$(game_name "$(basename "$f" .cpp)")
+
+	awk -v game="$GAME" '
+		# Emit the CRC and location of a ROM named by a RomSet.h macro, or of each ROM of a group
+		function emitRom(rom,    i, n, member)
+		{
+			if (rom in romCrc)
+			{
+				emit(romCrc[rom], romLoc[rom])
+			}
+			else if (rom in group)
+			{
+				n = split(group[rom], member, / +/)
+				for (i = 1; i <= n; i++) emitRom(member[i])
+			}
+		}
+		function emit(crc, loc)
+		{
+			crc = toupper(substr(crc, 3))
+			while (length(crc) < 8) crc = "0" crc
+			printf "%s\t%s\t%s\n", crc, substr(name, 1, 10), loc
+		}
+		# First pass - the ROM_SET descriptions of the tables, if the game has them,
+		# and the ROM macros the tables are built from (see CRomTools/RomSet.h)
+		FNR == NR {
+			if (match($0, /\{s_romRegion[A-Za-z0-9_]*, *"[^"]*"\}/))
+			{
+				entry = substr($0, RSTART + 1, RLENGTH - 3)
+				split(entry, part, /, *"/)
+				desc[part[1]] = part[2]
+			}
+			if ($1 == "#define" && match($0, /^#define [A-Z0-9_]+\(/))
+			{
+				# A ROM taking its CRC - the location is fixed
+				if (match($0, /"[^"]*"\}/))
+				{
+					macro = $2
+					sub(/\(.*/, "", macro)
+					paramLoc[macro] = substr($0, RSTART, RLENGTH - 1)
+				}
+			}
+			else if ($1 == "#define" && match($0, /0x[0-9A-Fa-f]+, *"[^"]*"\}/))
+			{
+				entry = substr($0, RSTART, RLENGTH - 1)
+				split(entry, part, /, */)
+				romCrc[$2] = part[1]
+				romLoc[$2] = part[2]
+			}
+			else if ($1 == "#define" && $3 ~ /^[A-Z][A-Z0-9_]*,?$/)
+			{
+				line = $0
+				sub(/\/\/.*/, "", line)
+				sub(/^#define +[A-Z0-9_]+ +/, "", line)
+				gsub(/,/, " ", line)
+				group[$2] = line
+			}
+			next
+		}
+		/^[ \t]*\/\// { next }
+		/static const ROM_(REGION|CHIP) [A-Za-z0-9_]+\[\] PROGMEM *= *\{/ {
+			match($0, /ROM_(REGION|CHIP) [A-Za-z0-9_]+/)
+			set = substr($0, RSTART, RLENGTH)
+			sub(/^ROM_[A-Z]+ /, "", set)
+			if (set in desc)
+			{
+				name = desc[set]
+				sub(/ +$/, "", name)
+				inTable = 1
+				next
+			}
+			sub(/^s_rom(Region|Chip)/, "", set)
+			sub(/^Set/, "", set)
+			sub(/^_/, "", set)
+			gsub(/_/, "", set)
+			name = (set == "") ? game : game " " set
+			inTable = 1
+			next
+		}
+		inTable && /\{0\}/ { inTable = 0; next }
+		inTable && match($0, /0x[0-9A-Fa-f]+, *"[^"]*"/) {
+			entry = substr($0, RSTART, RLENGTH)
+			split(entry, part, /, */)
+			emit(part[1], part[2])
+			next
+		}
+		inTable {
+			line = $0
+			sub(/\/\/.*/, "", line)
+			# ROMs that take their CRC, e.g. PL_ROM_8D(s_romData_PL5_02_8D, 0x4DDA0854)
+			while (match(line, /[A-Z][A-Z0-9_]*\([^)]*\)/))
+			{
+				call = substr(line, RSTART, RLENGTH)
+				line = substr(line, 1, RSTART - 1) substr(line, RSTART + RLENGTH)
+				macro = call
+				sub(/\(.*/, "", macro)
+				if ((macro in paramLoc) && match(call, /0x[0-9A-Fa-f]+/))
+				{
+					emit(substr(call, RSTART, RLENGTH), paramLoc[macro])
+				}
+			}
+			# ROMs and groups of ROMs by name
+			gsub(/,/, " ", line)
+			n = split(line, token, / +/)
+			for (i = 1; i <= n; i++) emitRom(token[i])
+		}
+	' "$f" "$f"
+done | awk -F '\t' '
+	# One entry per image and socket - the first set that uses it, in table order
+	!seen[$1 FS $3]++' | sort -s -t "$(printf '\t')" -k1,1 | awk -F '\t' '
+	{
+	printf "    {0x%s, %-13s %s},\n", $1, "\"" $2 "\",", $3
+}'
+
+printf '    {0} // end of list\n};\n\n'
+printf 'const UINT16 g_romCrcIndexCount = (sizeof(g_romCrcIndex) / sizeof(g_romCrcIndex[0])) - 1;\n'
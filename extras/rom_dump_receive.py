@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+
+# Receives the 'ROM Dump' binary stream from the ICT (see CRomTools/CRomDump.h) and
+# saves each ROM as <index>_<location>_<start>.bin, checking every frame CRC and the
+# CRC32 of each whole ROM against the game's table.
+#
+# Needs pyserial. Start this first, then run 'ROM Dump' on the ICT - opening the port
+# can reset the Mega so it's opened once and left open.
+#
+#   rom_dump_receive.py /dev/ttyACM0 [output dir] [baud]
+
+import os
+import struct
+import sys
+import zlib
+
+import serial
+
+SYNC = 0xA5
+
+
+def read_exact(port, count):
+    data = b''
+    while len(data) < count:
+        data += port.read(count - len(data))
+    return data
+
+
+def read_frame(port):
+    while read_exact(port, 1)[0] != SYNC:
+        pass
+
+    head = read_exact(port, 3)
+    length = struct.unpack('<H', head[1:3])[0]
+    payload = read_exact(port, length)
+    crc = struct.unpack('<I', read_exact(port, 4))[0]
+
+    if zlib.crc32(head + payload) != crc:
+        return None, None
+
+    return chr(head[0]), payload
+
+
+def report_incomplete(rom):
+    print('%02d_%s_%04X.bin  incomplete, %d of %d bytes' %
+          (rom['index'], rom['location'], rom['start'], rom['got'], len(rom['data'])))
+
+
+def main():
+    if len(sys.argv) < 2:
+        print("Usage: rom_dump_receive.py <port> [output dir] [baud]")
+        sys.exit(1)
+
+    out = sys.argv[2] if len(sys.argv) > 2 else '.'
+    baud = int(sys.argv[3]) if len(sys.argv) > 3 else 1000000
+    port = serial.Serial(sys.argv[1], baud, dsrdtr=False, rtscts=False)
+
+    rom = None
+    bad = 0
+    saved = 0
+    failed = 0
+    incomplete = 0
+
+    print("Waiting for ROM Dump...")
+
+    while True:
+        kind, payload = read_frame(port)
+
+        if kind is None:
+            print("  bad frame CRC")
+            bad += 1
+
+        elif kind == 'R':
+            if rom is not None:
+                report_incomplete(rom)
+                incomplete += 1
+
+            index, start, length, crc = struct.unpack('<BIII', payload[:13])
+            location = payload[13:].split(b'\0')[0].decode().strip()
+            rom = {'index': index, 'start': start, 'crc': crc, 'location': location,
+                   'data': bytearray(length), 'got': 0}
+
+        elif kind == 'D' and rom is not None:
+            offset = struct.unpack('<I', payload[:4])[0]
+            rom['data'][offset:offset + len(payload) - 4] = payload[4:]
+            rom['got'] += len(payload) - 4
+
+            if rom['got'] >= len(rom['data']):
+                name = '%02d_%s_%04X.bin' % (rom['index'], rom['location'], rom['start'])
+                crc = zlib.crc32(rom['data'])
+                with open(os.path.join(out, name), 'wb') as f:
+                    f.write(rom['data'])
+                print('%-16s %08X %s' % (name, crc, 'OK' if crc == rom['crc'] else 'expected %08X' % rom['crc']))
+                saved += 1
+                if crc != rom['crc']:
+                    failed += 1
+                rom = None
+
+        elif kind == 'E':
+            if rom is not None:
+                report_incomplete(rom)
+                incomplete += 1
+
+            print("%d of %d ROMs saved, %d bad CRC, %d incomplete, %d bad frames" %
+                  (saved, payload[0], failed, incomplete, bad))
+            break
+
+    # Non-zero if any ROM didn't arrive whole and good.
+    sys.exit(1 if (bad or failed or incomplete or saved != payload[0]) else 0)
+
+
+if __name__ == '__main__':
+    main()
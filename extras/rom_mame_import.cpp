@@ -0,0 +1,471 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+//
+// Host tool - prints the ROM_REGION table of a romset from its MAME driver:
+//
+//   g++ -std=c++11 -O2 -pthread -o rom_mame_import extras/rom_mame_import.cpp
+//
+//   rom_mame_import [-r region] [-n table] [-s cpu space] [-w window -a address -b callback]
+//                   <driver.cpp> <set> <rompath>
+//
+// The set's ROM_START block gives each CPU ROM's name, load address and size and its CRC.
+// Each ROM is found in the rompath (searched recursively, so a clone's parent set is found
+// too) by name and CRC, or by CRC alone if it has been renamed. Its 2^n samples come from
+// the image, the socket from its MAME extension and the CRC is checked against the driver
+// so a bad dump or a wrong file can't make its way into a table.
+//
+// Only the -r region is imported ("maincpu" by default). ROMs loaded past the CPU's address
+// space (-s, 0x10000 by default) are banked and are cut into -w sized slices that appear
+// at -a, with the -b callback, as rom_table_gen does, e.g. for Pacland:
+//
+//   rom_mame_import -w 0x2000 -a 0x4000 -b 'CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_%s>'
+//                   namco/pacland.cpp paclandj ~/mame/roms
+//
+// ROM_CONTINUE parts become entries of their own at their own address. ROM_RELOAD mirrors
+// are skipped, as are nibble, 16 bit and interleaved loads - the ICT's CPUs have 8-bit buses.
+//
+// Exits 1 if any ROM is missing or its image doesn't match the driver's CRC.
+//
+
+#include "RomHost.h"
+
+#include <stdlib.h>
+#include <strings.h>
+
+//
+// One part of a ROM_LOAD - the load itself or one of its ROM_CONTINUEs.
+//
+typedef struct _MAME_PART {
+    uint32_t offset;      // Offset in the region - the CPU address when not banked
+    uint32_t length;
+    uint32_t fileOffset;  // Where the part starts in the image
+} MAME_PART;
+
+//
+// An image in the rompath - mapped and CRC'd only when a ROM might be it.
+//
+typedef struct _ROM_CANDIDATE {
+    ROM_FILE  file;
+    bool      hashed;
+    uint32_t  crc;
+} ROM_CANDIDATE;
+
+//
+// A macro call of a ROM_START block and its arguments.
+//
+typedef std::pair<std::string, std::vector<std::string> > MAME_CALL;
+
+typedef struct _MAME_ROM {
+    std::string             name;
+    uint32_t                crc;
+    bool                    dumped;
+    std::vector<MAME_PART>  parts;
+} MAME_ROM;
+
+//
+// The macro calls between ROM_START( set ) and ROM_END, outermost only.
+//
+static bool
+findRomStart(
+    const std::string      &text,
+    const std::string      &set,
+    std::vector<MAME_CALL> *calls
+)
+{
+    size_t at = 0;
+
+    while ((at = text.find("ROM_START", at)) != std::string::npos)
+    {
+        size_t open  = text.find('(', at);
+        size_t close = text.find(')', open);
+
+        at = close;
+
+        if ((open == std::string::npos) || (close == std::string::npos) ||
+            (romTrim(text.substr(open + 1, close - open - 1)) != set))
+        {
+            continue;
+        }
+
+        size_t end = text.find("ROM_END", close);
+
+        end = (end == std::string::npos) ? text.size() : end;
+
+        for (size_t i = close + 1 ; i < end ; )
+        {
+            if (!romIsIdentifier(text[i]) || romIsIdentifier(text[i - 1]))
+            {
+                i++;
+                continue;
+            }
+
+            size_t nameEnd = i;
+
+            while ((nameEnd < end) && romIsIdentifier(text[nameEnd]))
+            {
+                nameEnd++;
+            }
+
+            size_t paren = text.find_first_not_of(" \t\r\n", nameEnd);
+
+            if ((paren == std::string::npos) || (paren >= end) || (text[paren] != '('))
+            {
+                i = nameEnd;
+                continue;
+            }
+
+            int depth = 0;
+            size_t last = paren;
+
+            for ( ; last < end ; last++)
+            {
+                depth += (text[last] == '(') ? 1 : ((text[last] == ')') ? -1 : 0);
+
+                if (depth == 0)
+                {
+                    break;
+                }
+            }
+
+            calls->push_back(MAME_CALL(text.substr(i, nameEnd - i),
+                                       romSplitArguments(text.substr(paren + 1, last - paren - 1))));
+            i = last + 1;
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+static std::string
+unquote(
+    const std::string &text
+)
+{
+    std::string value = romTrim(text);
+
+    return ((value.size() >= 2) && (value[0] == '"')) ? value.substr(1, value.size() - 2) : value;
+}
+
+//
+// The ROMs the set loads into one region.
+//
+static void
+readRegion(
+    const std::vector<MAME_CALL> &calls,
+    const std::string            &region,
+    std::vector<MAME_ROM>        *roms
+)
+{
+    bool inRegion = false;
+
+    for (size_t c = 0 ; c < calls.size() ; c++)
+    {
+        const std::string &macro = calls[c].first;
+        const std::vector<std::string> &args = calls[c].second;
+
+        if (macro.compare(0, 10, "ROM_REGION") == 0)
+        {
+            inRegion = (args.size() >= 2) && (unquote(args[1]) == region);
+        }
+        else if (!inRegion)
+        {
+            continue;
+        }
+        else if (((macro == "ROM_LOAD") || (macro == "ROM_LOAD_OPTIONAL") ||
+                  ((macro == "ROMX_LOAD") && (args.size() >= 5) && (romTrim(args[4]) == "0"))) &&
+                 (args.size() >= 4))
+        {
+            MAME_ROM rom;
+            MAME_PART part;
+            size_t crc = args[3].find("CRC(");
+
+            rom.name    = unquote(args[0]);
+            rom.dumped  = (crc != std::string::npos);
+            rom.crc     = rom.dumped ? (uint32_t) strtoul(args[3].c_str() + crc + 4, NULL, 16) : 0;
+
+            part.offset     = (uint32_t) strtoul(romTrim(args[1]).c_str(), NULL, 0);
+            part.length     = (uint32_t) strtoul(romTrim(args[2]).c_str(), NULL, 0);
+            part.fileOffset = 0;
+
+            rom.parts.push_back(part);
+            roms->push_back(rom);
+        }
+        else if ((macro == "ROM_CONTINUE") && (args.size() >= 2) && !roms->empty())
+        {
+            MAME_ROM &rom = roms->back();
+            MAME_PART part;
+
+            part.offset     = (uint32_t) strtoul(romTrim(args[0]).c_str(), NULL, 0);
+            part.length     = (uint32_t) strtoul(romTrim(args[1]).c_str(), NULL, 0);
+            part.fileOffset = rom.parts.back().fileOffset + rom.parts.back().length;
+
+            rom.parts.push_back(part);
+        }
+        else if (macro == "ROM_RELOAD")
+        {
+            fprintf(stderr, "%s: ROM_RELOAD mirror skipped\n", roms->empty() ? "?" : roms->back().name.c_str());
+        }
+        else if ((macro.compare(0, 8, "ROM_LOAD") == 0) || (macro == "ROMX_LOAD"))
+        {
+            fprintf(stderr, "%s: %s is not an 8-bit load - skipped\n",
+                    args.empty() ? "?" : unquote(args[0]).c_str(), macro.c_str());
+        }
+    }
+}
+
+//
+// The image of a ROM - by name and CRC, or by CRC alone.
+//
+static const ROM_FILE *
+findImage(
+    const MAME_ROM             &rom,
+    std::vector<ROM_CANDIDATE> *candidates,
+    bool                       *named
+)
+{
+    *named = false;
+
+    for (int pass = 0 ; pass < 2 ; pass++)
+    {
+        for (size_t c = 0 ; c < candidates->size() ; c++)
+        {
+            ROM_CANDIDATE &candidate = (*candidates)[c];
+            bool sameName = (strcasecmp(romBaseName(candidate.file.path).c_str(), rom.name.c_str()) == 0);
+
+            if ((pass == 0) && !sameName)
+            {
+                continue;
+            }
+
+            *named = *named || sameName;
+
+            if (!candidate.hashed)
+            {
+                if (!romMapFile(candidate.file.path, &candidate.file))
+                {
+                    continue;
+                }
+
+                candidate.crc    = romCrc32(candidate.file.data, candidate.file.size);
+                candidate.hashed = true;
+            }
+
+            if (candidate.crc == rom.crc)
+            {
+                return &candidate.file;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static void
+usage(
+)
+{
+    fprintf(stderr, "Usage: rom_mame_import [-r region] [-n table] [-s cpu space] [-w window -a address -b callback]\n"
+                    "                       <driver.cpp> <set> <rompath>\n");
+    exit(2);
+}
+
+int
+main(
+    int  argc,
+    char *argv[]
+)
+{
+    std::string region("maincpu");
+    std::string table;
+    std::string bankSwitch("bankSwitch_%s");
+    uint32_t space = 0x10000;
+    uint32_t window = 0;
+    uint32_t windowStart = 0;
+    int errors = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "r:n:s:w:a:b:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'r' : region      = optarg; break;
+            case 'n' : table       = optarg; break;
+            case 's' : space       = (uint32_t) strtoul(optarg, NULL, 0); break;
+            case 'w' : window      = (uint32_t) strtoul(optarg, NULL, 0); break;
+            case 'a' : windowStart = (uint32_t) strtoul(optarg, NULL, 0); break;
+            case 'b' : bankSwitch  = optarg; break;
+            default  : usage();
+        }
+    }
+
+    if (argc - optind != 3)
+    {
+        usage();
+    }
+
+    std::string driver(argv[optind]);
+    std::string set(argv[optind + 1]);
+    std::string source;
+    std::vector<MAME_CALL> calls;
+    std::vector<MAME_ROM> roms;
+
+    if (!romReadText(driver, &source))
+    {
+        perror(driver.c_str());
+        return 2;
+    }
+
+    if (!findRomStart(romStripComments(source), set, &calls))
+    {
+        fprintf(stderr, "No ROM_START( %s ) in %s\n", set.c_str(), driver.c_str());
+        return 2;
+    }
+
+    readRegion(calls, region, &roms);
+
+    if (roms.empty())
+    {
+        fprintf(stderr, "%s loads no ROMs into \"%s\"\n", set.c_str(), region.c_str());
+        return 2;
+    }
+
+    //
+    // The images, mapped as they are needed.
+    //
+    std::vector<std::string> paths;
+    std::vector<ROM_CANDIDATE> candidates;
+    std::vector<ROM_ENTRY> entries;
+
+    romListDirectory(argv[optind + 2], true, &paths);
+
+    for (size_t p = 0 ; p < paths.size() ; p++)
+    {
+        ROM_CANDIDATE candidate;
+
+        candidate.file.path = paths[p];
+        candidate.file.data = NULL;
+        candidate.file.size = 0;
+        candidate.hashed    = false;
+        candidate.crc       = 0;
+
+        candidates.push_back(candidate);
+    }
+
+    for (size_t r = 0 ; r < roms.size() ; r++)
+    {
+        const MAME_ROM &rom = roms[r];
+        bool named;
+
+        if (!rom.dumped)
+        {
+            fprintf(stderr, "%s: no CRC in the driver (NO_DUMP) - skipped\n", rom.name.c_str());
+            errors++;
+            continue;
+        }
+
+        const ROM_FILE *image = findImage(rom, &candidates, &named);
+
+        if (image == NULL)
+        {
+            fprintf(stderr, "%s: %s CRC 0x%08X\n", rom.name.c_str(), named ? "no image of that name has the driver's" : "no image with", rom.crc);
+            errors++;
+            continue;
+        }
+
+        if (strcasecmp(romBaseName(image->path).c_str(), rom.name.c_str()) != 0)
+        {
+            fprintf(stderr, "%s: found by CRC as %s\n", rom.name.c_str(), image->path.c_str());
+        }
+
+        for (size_t p = 0 ; p < rom.parts.size() ; p++)
+        {
+            const MAME_PART &part = rom.parts[p];
+            bool banked = (part.offset + part.length > space);
+            std::string file(rom.name);
+            std::string name(romCName(rom.name));
+
+            if (part.fileOffset + part.length > image->size)
+            {
+                fprintf(stderr, "%s: 0x%X bytes at +0x%X is past the end of %s\n",
+                        rom.name.c_str(), part.length, part.fileOffset, image->path.c_str());
+                errors++;
+                continue;
+            }
+
+            if (banked && (window == 0))
+            {
+                fprintf(stderr, "%s: loaded at 0x%X, past the CPU space - give its bank window with -w and -a\n",
+                        rom.name.c_str(), part.offset);
+                errors++;
+                continue;
+            }
+
+            if (rom.parts.size() > 1)
+            {
+                char suffix[16];
+
+                //
+                // ROM_CONTINUE parts are named by their position in the image.
+                //
+                snprintf(suffix, sizeof(suffix), " +0x%X", part.fileOffset);
+                file += suffix;
+                name += "_" + std::to_string(p);
+            }
+
+            romAddEntries(file,
+                          name,
+                          image->data + part.fileOffset,
+                          part.length,
+                          romMameLocation(rom.name),
+                          part.offset,
+                          banked ? window : 0,
+                          windowStart,
+                          bankSwitch,
+                          banked,
+                          &entries);
+        }
+    }
+
+    romComputeEntries(&entries);
+
+    if (table.empty())
+    {
+        table = "s_romRegion" + set;
+        table[11] = (char) toupper((unsigned char) table[11]);
+    }
+
+    printf("//\n// %s from MAME (%s)\n//\n", set.c_str(), romBaseName(driver).c_str());
+    romPrintTable(entries, table);
+
+    for (size_t c = 0 ; c < candidates.size() ; c++)
+    {
+        romUnmapFile(&candidates[c].file);
+    }
+
+    return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,510 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+
+//
+// Host tool - finds the nearest known ROM to a chip whose CRC matches nothing, e.g. the
+// images saved by rom_dump_receive.py from a bootleg board:
+//
+//   g++ -std=c++11 -O2 -pthread -o rom_nearest extras/rom_nearest.cpp
+//
+//   rom_nearest [-k block] [-n count] [-a address] <library> <dump | dump dir> ...
+//
+// The library is any directory of images, e.g. a MAME rompath. Every library image is cut
+// into blocks (0x100 bytes unless -k is given) and each block is indexed by its CRC32.
+// Each block of a dump then votes for the images, and the offsets within them, that hold
+// the same block, so a 2K chip is also found inside a 4K image. The best candidates are
+// compared byte for byte and the nearest are printed with the blocks that differ, e.g.
+//
+//   rom_nearest -a 0x1800 ~/mame/roms dumps/05_E_1800.bin
+//
+//   05_E_1800.bin  2048 bytes  CRC 8A37C6B2
+//     nearest  invaders/invaders.e  7/8 blocks  9 bytes differ
+//       0x1B00-0x1BFF  9 bytes differ
+//
+// -a gives the address of the chip so that the blocks are printed as CPU addresses.
+//
+
+#include "RomHost.h"
+
+#include <chrono>
+#include <unordered_map>
+
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Blocks shared by more images than this (blank 0x00/0xFF fill, common library code)
+// don't vote - they say nothing about which ROM a dump is and would swamp the count.
+// They are still compared once a candidate is found.
+//
+static const size_t c_maxVoters = 64;
+
+//
+// Candidates compared byte for byte for each one printed.
+//
+static const size_t c_comparePerResult = 8;
+
+//
+// Differing ranges printed per result.
+//
+static const size_t c_maxRanges = 16;
+
+//
+// A library image and the CRC of each of its blocks.
+//
+typedef struct _ROM_LIBRARY_IMAGE {
+    ROM_FILE              file;
+    uint32_t              crc;
+    std::vector<uint32_t> blocks;
+} ROM_LIBRARY_IMAGE;
+
+//
+// Where a block occurs in the library.
+//
+typedef struct _ROM_BLOCK_REF {
+    uint32_t image;
+    uint32_t block;
+} ROM_BLOCK_REF;
+
+//
+// A dump compared with the part of a library image at offset.
+//
+typedef struct _ROM_MATCH {
+    uint32_t image;
+    size_t   offset;
+    unsigned votes;
+    unsigned sameBlocks;
+    size_t   differentBytes;
+} ROM_MATCH;
+
+typedef struct _ROM_LIBRARY {
+    size_t                                                blockSize;
+    std::vector<ROM_LIBRARY_IMAGE>                        images;
+    std::unordered_map<uint32_t, std::vector<ROM_BLOCK_REF> > index;
+    std::unordered_multimap<uint32_t, uint32_t>           crcs;
+} ROM_LIBRARY;
+
+static std::string
+hex(
+    size_t value
+)
+{
+    char text[20];
+
+    snprintf(text, sizeof(text), "0x%04X", (unsigned) value);
+
+    return std::string(text);
+}
+
+static std::string
+differ(
+    size_t bytes
+)
+{
+    char text[32];
+
+    snprintf(text, sizeof(text), (bytes == 1) ? "%u byte differs" : "%u bytes differ", (unsigned) bytes);
+
+    return std::string(text);
+}
+
+//
+// Map every image, then CRC each one and its blocks on every core.
+//
+static void
+loadLibrary(
+    const std::string &path,
+    ROM_LIBRARY       *library
+)
+{
+    std::vector<std::string> paths;
+
+    romListDirectory(path, true, &paths);
+
+    for (size_t p = 0 ; p < paths.size() ; p++)
+    {
+        ROM_LIBRARY_IMAGE image;
+
+        if (romMapFile(paths[p], &image.file))
+        {
+            image.crc = 0;
+            library->images.push_back(image);
+        }
+    }
+
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (unsigned t = 0 ; t < std::min<size_t>(threads, library->images.size()) ; t++)
+    {
+        workers.push_back(std::thread([library, &next]()
+        {
+            for (size_t i = next++ ; i < library->images.size() ; i = next++)
+            {
+                ROM_LIBRARY_IMAGE &image = library->images[i];
+
+                image.crc = romCrc32(image.file.data, image.file.size);
+
+                for (size_t b = 0 ; (b + 1) * library->blockSize <= image.file.size ; b++)
+                {
+                    image.blocks.push_back(romCrc32(image.file.data + b * library->blockSize, library->blockSize));
+                }
+            }
+        }));
+    }
+
+    for (size_t t = 0 ; t < workers.size() ; t++)
+    {
+        workers[t].join();
+    }
+
+    for (uint32_t i = 0 ; i < library->images.size() ; i++)
+    {
+        const ROM_LIBRARY_IMAGE &image = library->images[i];
+
+        library->crcs.insert(std::make_pair(image.crc, i));
+
+        for (uint32_t b = 0 ; b < image.blocks.size() ; b++)
+        {
+            ROM_BLOCK_REF ref = { i, b };
+            library->index[image.blocks[b]].push_back(ref);
+        }
+    }
+}
+
+//
+// Compare a dump with the image region at match->offset, block by block.
+//
+static void
+compare(
+    const ROM_LIBRARY &library,
+    const ROM_FILE    &dump,
+    ROM_MATCH         *match
+)
+{
+    const uint8_t *data = library.images[match->image].file.data + match->offset;
+
+    match->sameBlocks = 0;
+    match->differentBytes = 0;
+
+    for (size_t b = 0 ; b < dump.size ; b += library.blockSize)
+    {
+        size_t length = std::min(library.blockSize, dump.size - b);
+
+        if (memcmp(dump.data + b, data + b, length) == 0)
+        {
+            match->sameBlocks++;
+            continue;
+        }
+
+        for (size_t i = b ; i < b + length ; i++)
+        {
+            match->differentBytes += (dump.data[i] != data[i]);
+        }
+    }
+}
+
+//
+// Runs of differing blocks, with the number of bytes that differ in each run.
+//
+static void
+printRanges(
+    const ROM_LIBRARY &library,
+    const ROM_FILE    &dump,
+    const ROM_MATCH   &match,
+    size_t            address
+)
+{
+    const uint8_t *data = library.images[match.image].file.data + match.offset;
+    size_t ranges = 0;
+    size_t b = 0;
+
+    while (b < dump.size)
+    {
+        size_t start = b;
+        size_t bytes = 0;
+
+        for ( ; b < dump.size ; b += library.blockSize)
+        {
+            size_t length = std::min(library.blockSize, dump.size - b);
+            size_t changed = 0;
+
+            for (size_t i = b ; i < b + length ; i++)
+            {
+                changed += (dump.data[i] != data[i]);
+            }
+
+            if (changed == 0)
+            {
+                break;
+            }
+
+            bytes += changed;
+        }
+
+        if (bytes != 0)
+        {
+            if (ranges++ < c_maxRanges)
+            {
+                printf("      %s-%s  %s\n",
+                       hex(address + start).c_str(),
+                       hex(address + std::min(b, dump.size) - 1).c_str(),
+                       differ(bytes).c_str());
+            }
+        }
+        else
+        {
+            b += library.blockSize;
+        }
+    }
+
+    if (ranges > c_maxRanges)
+    {
+        printf("      ... %u more\n", (unsigned) (ranges - c_maxRanges));
+    }
+}
+
+static bool
+nearer(
+    const ROM_MATCH &a,
+    const ROM_MATCH &b
+)
+{
+    if (a.sameBlocks != b.sameBlocks)
+    {
+        return a.sameBlocks > b.sameBlocks;
+    }
+
+    return a.differentBytes < b.differentBytes;
+}
+
+static void
+searchDump(
+    const ROM_LIBRARY &library,
+    const ROM_FILE    &dump,
+    const std::string &root,
+    size_t            count,
+    size_t            address
+)
+{
+    uint32_t crc = romCrc32(dump.data, dump.size);
+    size_t dumpBlocks = (dump.size + library.blockSize - 1) / library.blockSize;
+
+    printf("%s  %u bytes  CRC %08X\n", romBaseName(dump.path).c_str(), (unsigned) dump.size, crc);
+
+    //
+    // A whole image with the same CRC needs no search.
+    //
+    std::pair<std::unordered_multimap<uint32_t, uint32_t>::const_iterator,
+              std::unordered_multimap<uint32_t, uint32_t>::const_iterator> same = library.crcs.equal_range(crc);
+
+    if (same.first != same.second)
+    {
+        for ( ; same.first != same.second ; ++same.first)
+        {
+            printf("  matches  %s\n", library.images[same.first->second].file.path.substr(root.size() + 1).c_str());
+        }
+
+        return;
+    }
+
+    //
+    // Each full block votes for every (image, offset) that holds it at the same place
+    // relative to the start of the dump.
+    //
+    std::unordered_map<uint64_t, unsigned> votes;
+
+    for (size_t d = 0 ; (d + 1) * library.blockSize <= dump.size ; d++)
+    {
+        std::unordered_map<uint32_t, std::vector<ROM_BLOCK_REF> >::const_iterator it =
+            library.index.find(romCrc32(dump.data + d * library.blockSize, library.blockSize));
+
+        if ((it == library.index.end()) || (it->second.size() > c_maxVoters))
+        {
+            continue;
+        }
+
+        for (size_t r = 0 ; r < it->second.size() ; r++)
+        {
+            const ROM_BLOCK_REF &ref = it->second[r];
+
+            if (ref.block < d)
+            {
+                continue;
+            }
+
+            size_t offset = (ref.block - d) * library.blockSize;
+
+            if (offset + dump.size <= library.images[ref.image].file.size)
+            {
+                votes[((uint64_t) ref.image << 32) | (ref.block - d)]++;
+            }
+        }
+    }
+
+    std::vector<ROM_MATCH> matches;
+
+    for (std::unordered_map<uint64_t, unsigned>::const_iterator it = votes.begin() ; it != votes.end() ; ++it)
+    {
+        ROM_MATCH match = { (uint32_t) (it->first >> 32), (size_t) (uint32_t) it->first * library.blockSize, it->second, 0, 0 };
+        matches.push_back(match);
+    }
+
+    if (matches.empty())
+    {
+        printf("  no similar ROM in the library\n");
+        return;
+    }
+
+    //
+    // Only the best voted are worth comparing byte for byte.
+    //
+    size_t compared = std::min(matches.size(), count * c_comparePerResult);
+
+    std::partial_sort(matches.begin(), matches.begin() + compared, matches.end(),
+                      [](const ROM_MATCH &a, const ROM_MATCH &b) { return a.votes > b.votes; });
+    matches.resize(compared);
+
+    for (size_t m = 0 ; m < matches.size() ; m++)
+    {
+        compare(library, dump, &matches[m]);
+    }
+
+    std::sort(matches.begin(), matches.end(), nearer);
+
+    for (size_t m = 0 ; m < std::min(matches.size(), count) ; m++)
+    {
+        const ROM_MATCH &match = matches[m];
+        const ROM_FILE &image = library.images[match.image].file;
+        std::string name = image.path.substr(root.size() + 1);
+
+        if ((match.offset != 0) || (image.size != dump.size))
+        {
+            name += " " + hex(match.offset) + "-" + hex(match.offset + dump.size - 1);
+        }
+
+        if (match.differentBytes == 0)
+        {
+            printf("  %s  %s  identical\n", (m == 0) ? "nearest" : "next   ", name.c_str());
+            continue;
+        }
+
+        printf("  %s  %s  %u/%u blocks  %s\n",
+               (m == 0) ? "nearest" : "next   ",
+               name.c_str(),
+               match.sameBlocks,
+               (unsigned) dumpBlocks,
+               differ(match.differentBytes).c_str());
+
+        printRanges(library, dump, match, address);
+    }
+}
+
+static void
+usage(
+)
+{
+    fprintf(stderr, "Usage: rom_nearest [-k block] [-n count] [-a address] <library> <dump | dump dir> ...\n");
+    exit(1);
+}
+
+int
+main(
+    int  argc,
+    char *argv[]
+)
+{
+    ROM_LIBRARY library;
+    size_t count = 3;
+    size_t address = 0;
+    int opt;
+
+    library.blockSize = 0x100;
+
+    while ((opt = getopt(argc, argv, "k:n:a:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'k' : library.blockSize = (size_t) strtoul(optarg, NULL, 0); break;
+            case 'n' : count             = (size_t) strtoul(optarg, NULL, 0); break;
+            case 'a' : address           = (size_t) strtoul(optarg, NULL, 0); break;
+            default  : usage();
+        }
+    }
+
+    if ((optind + 2 > argc) || (library.blockSize < 16) || (count == 0))
+    {
+        usage();
+    }
+
+    std::string root(argv[optind]);
+
+    while ((root.size() > 1) && (root[root.size() - 1] == '/'))
+    {
+        root.erase(root.size() - 1);
+    }
+
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+    loadLibrary(root, &library);
+
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    fprintf(stderr, "%u library images, %u distinct blocks indexed in %.1f ms\n",
+            (unsigned) library.images.size(), (unsigned) library.index.size(), ms);
+
+    std::vector<std::string> dumps;
+
+    for (int i = optind + 1 ; i < argc ; i++)
+    {
+        if (romIsDirectory(argv[i]))
+        {
+            romListDirectory(argv[i], false, &dumps);
+        }
+        else
+        {
+            dumps.push_back(argv[i]);
+        }
+    }
+
+    for (size_t d = 0 ; d < dumps.size() ; d++)
+    {
+        ROM_FILE dump;
+
+        if (romMapFile(dumps[d], &dump))
+        {
+            searchDump(library, dump, root, count, address);
+            romUnmapFile(&dump);
+        }
+    }
+
+    for (size_t i = 0 ; i < library.images.size() ; i++)
+    {
+        romUnmapFile(&library.images[i].file);
+    }
+
+    return 0;
+}
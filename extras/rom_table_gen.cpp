@@ -0,0 +1,217 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+//
+// Host tool - prints the 2^n sample arrays and the ROM_REGION table of a set of ROM images,
+// ready to paste into a game. Replaces rom_idx_dump.sh and runs on Linux and macOS:
+//
+//   g++ -std=c++11 -O2 -pthread -o rom_table_gen extras/rom_table_gen.cpp
+//
+//   rom_table_gen [-w window] [-a address] [-b callback] <romset dir | image[=LOC][@start]> ...
+//
+// A directory is read as an unzipped MAME romset. Each image takes its socket from its
+// MAME extension (pl5_01b.8b -> "8B ") unless =LOC is given, and starts at 0x0000 unless
+// @start is given. The images of a directory all start at the same address - 0x0000, or
+// the directory's @start - so name the images with their @start to lay out a board.
+//
+// -w cuts images larger than the window into slices, as for Pacland's 8K banked window
+// (images given a fixed @start are left whole):
+// each slice is named _Lo/_Hi (or _0, _1...), its socket gets the slice number as the
+// third character ("8E0", "8E1") and it starts at the -a address. Its bank switch is the
+// -b callback with %s replaced by the socket and slice, e.g.
+//
+//   rom_table_gen -w 0x2000 -a 0x4000 -b 'CPaclandBaseGame::onBankSwitchMPAGE<CPaclandBaseGame::MPAGE_%s>'
+//                 pl5_01b.8b@0x8000 pl5_02.8d@0xC000 pl1_3.8e pl1_4.8f pl1_5.8h pl3_6.8j
+//
+// The images are mapped rather than read and their CRCs are computed on every core.
+//
+
+#include "RomHost.h"
+
+#include <chrono>
+
+#include <stdlib.h>
+
+//
+// A mapped image and the socket and address it was given on the command line.
+//
+typedef struct _ROM_IMAGE {
+    ROM_FILE      file;
+    std::string   location;
+    uint32_t      start;
+    bool          fixed;      // @start was given - never sliced
+} ROM_IMAGE;
+
+static void
+addImage(
+    const std::string      &path,
+    const std::string      &location,
+    uint32_t               start,
+    bool                   fixed,
+    std::vector<ROM_IMAGE> *images
+)
+{
+    ROM_IMAGE image;
+
+    image.file.path = path;
+    image.file.data = NULL;
+    image.file.size = 0;
+    image.location  = location;
+    image.start     = start;
+    image.fixed     = fixed;
+
+    images->push_back(image);
+}
+
+//
+// image[=LOC][@start] - or a directory of images.
+//
+static void
+addArgument(
+    const char             *arg,
+    std::vector<ROM_IMAGE> *images
+)
+{
+    std::string path(arg);
+    std::string location;
+    uint32_t start = 0;
+    bool fixed = false;
+
+    size_t at = path.find('@');
+    if (at != std::string::npos)
+    {
+        start = (uint32_t) strtoul(path.c_str() + at + 1, NULL, 0);
+        fixed = true;
+        path.erase(at);
+    }
+
+    size_t eq = path.find('=');
+    if (eq != std::string::npos)
+    {
+        location = path.substr(eq + 1);
+        location.resize(3, ' ');
+        path.erase(eq);
+    }
+
+    if (romIsDirectory(path))
+    {
+        std::vector<std::string> files;
+
+        romListDirectory(path, false, &files);
+
+        for (size_t i = 0 ; i < files.size() ; i++)
+        {
+            addImage(files[i], romMameLocation(romBaseName(files[i])), start, fixed, images);
+        }
+    }
+    else
+    {
+        addImage(path, location.empty() ? romMameLocation(romBaseName(path)) : location, start, fixed, images);
+    }
+}
+
+static void
+usage(
+)
+{
+    fprintf(stderr, "Usage: rom_table_gen [-w window] [-a address] [-b callback] <romset dir | image[=LOC][@start]> ...\n");
+    fprintf(stderr, "Every image of a directory starts at 0x0000 (or the directory's @start) - give images their @start to lay out a board.\n");
+    exit(1);
+}
+
+int
+main(
+    int  argc,
+    char *argv[]
+)
+{
+    std::vector<ROM_IMAGE> images;
+    std::vector<ROM_ENTRY> entries;
+    std::string bankSwitch("bankSwitch_%s");
+    uint32_t window = 0;
+    uint32_t windowStart = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "w:a:b:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'w' : window      = (uint32_t) strtoul(optarg, NULL, 0); break;
+            case 'a' : windowStart = (uint32_t) strtoul(optarg, NULL, 0); break;
+            case 'b' : bankSwitch  = optarg; break;
+            default  : usage();
+        }
+    }
+
+    if (optind >= argc)
+    {
+        usage();
+    }
+
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+    for (int i = optind ; i < argc ; i++)
+    {
+        addArgument(argv[i], &images);
+    }
+
+    //
+    // Map the images and cut them into entries.
+    //
+    for (size_t i = 0 ; i < images.size() ; i++)
+    {
+        ROM_IMAGE &image = images[i];
+
+        if (!romMapFile(image.file.path, &image.file))
+        {
+            continue;
+        }
+
+        romAddEntries(romBaseName(image.file.path),
+                      romCName(romBaseName(image.file.path)),
+                      image.file.data,
+                      (uint32_t) image.file.size,
+                      image.location,
+                      image.start,
+                      image.fixed ? 0 : window,
+                      windowStart,
+                      bankSwitch,
+                      false,
+                      &entries);
+    }
+
+    romComputeEntries(&entries);
+    romPrintTable(entries, "s_romRegion");
+
+    for (size_t i = 0 ; i < images.size() ; i++)
+    {
+        romUnmapFile(&images[i].file);
+    }
+
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    fprintf(stderr, "%u ROMs in %.1f ms\n", (unsigned) entries.size(), ms);
+
+    return 0;
+}
@@ -0,0 +1,1087 @@
+//
+// Copyright (c) 2026, Phillip Riscombe-Burton
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+//
+// Host tool - checks every ROM_REGION table in the game sources, and optionally every
+// CRC32 and 2^n sample array against a directory of ROM images:
+//
+//   g++ -std=c++11 -O2 -pthread -o rom_table_verify extras/rom_table_verify.cpp
+//
+//   rom_table_verify [-s source root] [rompath]
+//
+// The tables are read from C*Cpu/*.cpp with their #define ROM macros (see CRomTools/RomSet.h),
+// sample arrays (UINT16 or ROM_DATA2N rows) and address and size constants resolved.
+//
+// From the source alone it reports unresolved entries, sample arrays shorter than the ROM
+// needs, a socket listed twice in one table, one CRC with two different sample arrays,
+// tables whose samples are all another table's under different CRCs (placeholder copies)
+// and sample arrays no table uses.
+//
+// With a rompath (MAME style, searched recursively) every entry is looked up by its CRC,
+// whole image or slice, and its samples compared with the image. An entry whose CRC isn't
+// found but whose samples are is reported as a wrong CRC. Images in the same romset as a
+// table's ROMs that no table lists are reported as unreferenced.
+//
+// Exits 1 if there are any errors.
+//
+
+#include "RomHost.h"
+
+#include <atomic>
+#include <map>
+#include <set>
+#include <thread>
+
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct _SOURCE_MACRO {
+    bool                      function;
+    std::vector<std::string>  params;
+    std::string               body;
+} SOURCE_MACRO;
+
+//
+// The constants, sample arrays and macros visible to the tables of one source file.
+//
+typedef struct _SOURCE_SCOPE {
+    std::map<std::string, std::string>            constants;
+    std::map<std::string, std::vector<uint32_t> > arrays;
+    std::map<std::string, SOURCE_MACRO>           macros;
+} SOURCE_SCOPE;
+
+typedef struct _TABLE_ENTRY {
+    std::string            bankSwitch;
+    std::string            data2nName;
+    std::vector<uint32_t>  data2n;
+    uint32_t               start;
+    uint32_t               length;
+    uint32_t               crc;
+    std::string            location;
+} TABLE_ENTRY;
+
+typedef struct _ROM_TABLE {
+    std::string               file;
+    std::string               name;
+    std::string               body;    // Unexpanded - the macros can follow the table
+    std::vector<TABLE_ENTRY>  entries;
+} ROM_TABLE;
+
+//
+// A whole image or a slice of one, as found in the rompath.
+//
+typedef struct _IMAGE_SLICE {
+    const ROM_FILE *file;
+    uint32_t       offset;
+    uint32_t       length;
+    uint32_t       crc;
+} IMAGE_SLICE;
+
+static unsigned s_errors;
+static unsigned s_warnings;
+
+static void
+report(
+    bool       error,
+    const char *format,
+    ...
+)
+{
+    va_list args;
+
+    va_start(args, format);
+    printf("%s: ", error ? "error" : "warning");
+    vprintf(format, args);
+    printf("\n");
+    va_end(args);
+
+    if (error)
+    {
+        s_errors++;
+    }
+    else
+    {
+        s_warnings++;
+    }
+}
+
+//
+// The text between the brace at open and its partner.
+//
+static std::string
+braceBody(
+    const std::string &text,
+    size_t            open,
+    size_t            *close
+)
+{
+    int depth = 0;
+
+    for (size_t i = open ; i < text.size() ; i++)
+    {
+        if (text[i] == '{')
+        {
+            depth++;
+        }
+        else if ((text[i] == '}') && (--depth == 0))
+        {
+            *close = i;
+            return text.substr(open + 1, i - open - 1);
+        }
+    }
+
+    *close = text.size();
+
+    return text.substr(open + 1);
+}
+
+static std::vector<uint32_t>
+parseNumbers(
+    const std::string &text
+)
+{
+    std::vector<std::string> parts = romSplitArguments(text);
+    std::vector<uint32_t> values;
+
+    for (size_t i = 0 ; i < parts.size() ; i++)
+    {
+        values.push_back((uint32_t) strtoul(parts[i].c_str(), NULL, 0));
+    }
+
+    return values;
+}
+
+//
+// Expand the ROM macros of a table - object and function like, one level of arguments.
+//
+static std::string
+expandMacros(
+    const std::string  &text,
+    const SOURCE_SCOPE &scope,
+    int                level
+)
+{
+    std::string out;
+
+    for (size_t i = 0 ; i < text.size() ; )
+    {
+        if (text[i] == '"')
+        {
+            size_t end = text.find('"', i + 1);
+
+            end = (end == std::string::npos) ? text.size() : end + 1;
+            out += text.substr(i, end - i);
+            i = end;
+            continue;
+        }
+
+        if (!romIsIdentifier(text[i]) || ((i > 0) && romIsIdentifier(text[i - 1])))
+        {
+            out += text[i++];
+            continue;
+        }
+
+        size_t end = i;
+
+        while ((end < text.size()) && romIsIdentifier(text[end]))
+        {
+            end++;
+        }
+
+        std::string word = text.substr(i, end - i);
+        std::map<std::string, SOURCE_MACRO>::const_iterator macro = scope.macros.find(word);
+
+        if ((macro == scope.macros.end()) || (level > 16))
+        {
+            out += word;
+            i = end;
+            continue;
+        }
+
+        if (!macro->second.function)
+        {
+            out += expandMacros(macro->second.body, scope, level + 1);
+            i = end;
+            continue;
+        }
+
+        size_t open = text.find_first_not_of(" \t\r\n", end);
+
+        if ((open == std::string::npos) || (text[open] != '('))
+        {
+            out += word;
+            i = end;
+            continue;
+        }
+
+        int depth = 0;
+        size_t close = open;
+
+        for ( ; close < text.size() ; close++)
+        {
+            depth += (text[close] == '(') ? 1 : ((text[close] == ')') ? -1 : 0);
+
+            if (depth == 0)
+            {
+                break;
+            }
+        }
+
+        std::vector<std::string> args = romSplitArguments(text.substr(open + 1, close - open - 1));
+        const std::string &body = macro->second.body;
+        std::string substituted;
+
+        for (size_t b = 0 ; b < body.size() ; )
+        {
+            if (romIsIdentifier(body[b]) && ((b == 0) || !romIsIdentifier(body[b - 1])))
+            {
+                size_t e = b;
+
+                while ((e < body.size()) && romIsIdentifier(body[e]))
+                {
+                    e++;
+                }
+
+                std::string name = body.substr(b, e - b);
+                size_t p = 0;
+
+                while ((p < macro->second.params.size()) && (macro->second.params[p] != name))
+                {
+                    p++;
+                }
+
+                substituted += ((p < macro->second.params.size()) && (p < args.size())) ? args[p] : name;
+                b = e;
+            }
+            else
+            {
+                substituted += body[b++];
+            }
+        }
+
+        out += expandMacros(substituted, scope, level + 1);
+        i = close + 1;
+    }
+
+    return out;
+}
+
+//
+// Numbers, constants (class qualified or not) and + / - between them.
+//
+static bool
+evaluate(
+    const std::string  &expression,
+    const SOURCE_SCOPE &scope,
+    uint32_t           *value,
+    int                level = 0
+)
+{
+    std::string text = romTrim(expression);
+    uint32_t total = 0;
+    int sign = 1;
+
+    while (!text.empty() && (text[0] == '(') && (text[text.size() - 1] == ')'))
+    {
+        text = romTrim(text.substr(1, text.size() - 2));
+    }
+
+    for (size_t i = 0 ; i < text.size() ; )
+    {
+        if (isspace((unsigned char) text[i]))
+        {
+            i++;
+        }
+        else if ((text[i] == '+') || (text[i] == '-'))
+        {
+            sign = (text[i++] == '-') ? -1 : 1;
+        }
+        else if (isdigit((unsigned char) text[i]))
+        {
+            char *end;
+            uint32_t term = (uint32_t) strtoul(text.c_str() + i, &end, 0);
+
+            while (*end == 'u' || *end == 'U' || *end == 'l' || *end == 'L')
+            {
+                end++;
+            }
+
+            total += (sign > 0) ? term : -term;
+            i = end - text.c_str();
+        }
+        else if (romIsIdentifier(text[i]) || (text[i] == ':'))
+        {
+            size_t end = i;
+            uint32_t term;
+
+            while ((end < text.size()) && (romIsIdentifier(text[end]) || (text[end] == ':')))
+            {
+                end++;
+            }
+
+            std::string name = text.substr(i, end - i);
+            size_t colon = name.rfind("::");
+
+            name = (colon == std::string::npos) ? name : name.substr(colon + 2);
+
+            std::map<std::string, std::string>::const_iterator constant = scope.constants.find(name);
+
+            if ((constant == scope.constants.end()) || (level > 8) || !evaluate(constant->second, scope, &term, level + 1))
+            {
+                return false;
+            }
+
+            total += (sign > 0) ? term : -term;
+            i = end;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    *value = total;
+
+    return !text.empty();
+}
+
+//
+// #define lines and static const declarations. Headers only give their constants
+// and macros to the scope; sources add their tables.
+//
+static void
+parseSource(
+    const std::string      &path,
+    SOURCE_SCOPE           *scope,
+    std::vector<ROM_TABLE> *tables
+)
+{
+    std::string raw;
+
+    if (!romReadText(path, &raw))
+    {
+        perror(path.c_str());
+        return;
+    }
+
+    std::string text = romStripComments(raw);
+    std::string code;
+
+    //
+    // Preprocessor lines, with their continuations.
+    //
+    for (size_t i = 0 ; i < text.size() ; )
+    {
+        size_t end = text.find('\n', i);
+        std::string line;
+
+        end = (end == std::string::npos) ? text.size() : end;
+        line = text.substr(i, end - i);
+        i = end + 1;
+
+        while (!line.empty() && (line[line.size() - 1] == '\\') && (i < text.size()))
+        {
+            end = text.find('\n', i);
+            end = (end == std::string::npos) ? text.size() : end;
+            line = line.substr(0, line.size() - 1) + " " + text.substr(i, end - i);
+            i = end + 1;
+        }
+
+        std::string directive = romTrim(line);
+
+        if (directive.compare(0, 7, "#define") != 0)
+        {
+            code += (directive.empty() || (directive[0] != '#')) ? line + "\n" : "\n";
+            continue;
+        }
+
+        size_t name = directive.find_first_not_of(" \t", 7);
+        size_t nameEnd = name;
+
+        while ((nameEnd < directive.size()) && romIsIdentifier(directive[nameEnd]))
+        {
+            nameEnd++;
+        }
+
+        SOURCE_MACRO macro;
+
+        macro.function = (nameEnd < directive.size()) && (directive[nameEnd] == '(');
+
+        if (macro.function)
+        {
+            size_t close = directive.find(')', nameEnd);
+
+            macro.params = romSplitArguments(directive.substr(nameEnd + 1, close - nameEnd - 1));
+            macro.body   = romTrim(directive.substr(close + 1));
+        }
+        else
+        {
+            macro.body = romTrim(directive.substr(nameEnd));
+        }
+
+        scope->macros[directive.substr(name, nameEnd - name)] = macro;
+    }
+
+    //
+    // static const <type> <name> = value; or static const <type> <name>[] ... = { ... };
+    //
+    for (size_t at = code.find("static const ") ; at != std::string::npos ; at = code.find("static const ", at + 1))
+    {
+        size_t typeStart = at + 13;
+        size_t typeEnd   = code.find_first_of(" \t", typeStart);
+        size_t nameStart = code.find_first_not_of(" \t", typeEnd);
+        size_t nameEnd   = nameStart;
+
+        while ((nameEnd < code.size()) && romIsIdentifier(code[nameEnd]))
+        {
+            nameEnd++;
+        }
+
+        std::string type = code.substr(typeStart, typeEnd - typeStart);
+        std::string name = code.substr(nameStart, nameEnd - nameStart);
+        size_t next = code.find_first_not_of(" \t", nameEnd);
+
+        if (next == std::string::npos)
+        {
+            break;
+        }
+
+        if (code[next] == '=')
+        {
+            size_t semi = code.find(';', next);
+
+            scope->constants[name] = romTrim(code.substr(next + 1, semi - next - 1));
+            continue;
+        }
+
+        if (code[next] != '[')
+        {
+            continue;
+        }
+
+        size_t open = code.find('{', next);
+        size_t semi = code.find(';', next);
+        size_t close;
+
+        if ((open == std::string::npos) || (semi < open))
+        {
+            continue;
+        }
+
+        std::string body = braceBody(code, open, &close);
+
+        if ((type == "UINT16") || (type == "UINT8"))
+        {
+            scope->arrays[name] = parseNumbers(body);
+        }
+        else if (type == "ROM_DATA2N")
+        {
+            std::vector<std::string> rows = romSplitArguments(body);
+
+            for (size_t r = 0 ; (r < rows.size()) && (romTrim(rows[r]) != "{0}") ; r++)
+            {
+                char key[128];
+
+                snprintf(key, sizeof(key), "%s[%u].data2n", name.c_str(), (unsigned) r);
+                scope->arrays[key] = parseNumbers(romTrim(rows[r]).substr(1, rows[r].size() - 2));
+            }
+        }
+        else if ((type == "ROM_REGION") && (tables != NULL))
+        {
+            ROM_TABLE table;
+
+            table.file = path;
+            table.name = name;
+            table.body = body;
+
+            tables->push_back(table);
+        }
+    }
+}
+
+//
+// Turn the unexpanded table bodies of one file into entries.
+//
+static void
+resolveTables(
+    const SOURCE_SCOPE     &scope,
+    std::vector<ROM_TABLE> *tables,
+    size_t                 first
+)
+{
+    for (size_t t = first ; t < tables->size() ; t++)
+    {
+        ROM_TABLE &table = (*tables)[t];
+        std::vector<std::string> rows = romSplitArguments(expandMacros(table.body, scope, 0));
+
+        for (size_t r = 0 ; r < rows.size() ; r++)
+        {
+            std::string row = romTrim(rows[r]);
+
+            if ((row.size() < 2) || (row[0] != '{'))
+            {
+                continue;
+            }
+
+            std::vector<std::string> fields = romSplitArguments(row.substr(1, row.size() - 2));
+
+            if ((fields.size() == 1) && (fields[0] == "0"))
+            {
+                break;
+            }
+
+            if (fields.size() != 6)
+            {
+                report(true, "%s %s: can't read entry %s", table.file.c_str(), table.name.c_str(), row.c_str());
+                continue;
+            }
+
+            TABLE_ENTRY entry;
+            std::string data2n;
+
+            for (size_t c = 0 ; c < fields[3].size() ; c++)
+            {
+                data2n += isspace((unsigned char) fields[3][c]) ? "" : std::string(1, fields[3][c]);
+            }
+
+            entry.bankSwitch = fields[0];
+            entry.data2nName = data2n;
+            entry.crc        = (uint32_t) strtoul(fields[4].c_str(), NULL, 0);
+            entry.location   = (fields[5].size() >= 2) ? fields[5].substr(1, fields[5].size() - 2) : fields[5];
+
+            if (!evaluate(fields[1], scope, &entry.start) || !evaluate(fields[2], scope, &entry.length))
+            {
+                report(true, "%s %s %s: can't resolve start %s or length %s",
+                       table.file.c_str(), table.name.c_str(), entry.location.c_str(), fields[1].c_str(), fields[2].c_str());
+                continue;
+            }
+
+            std::map<std::string, std::vector<uint32_t> >::const_iterator array = scope.arrays.find(data2n);
+
+            if (array == scope.arrays.end())
+            {
+                report(true, "%s %s %s: no sample array %s", table.file.c_str(), table.name.c_str(), entry.location.c_str(), data2n.c_str());
+                continue;
+            }
+
+            entry.data2n = array->second;
+            table.entries.push_back(entry);
+        }
+    }
+}
+
+//
+// The checks that need no images.
+//
+static void
+checkSources(
+    const std::vector<ROM_TABLE> &tables,
+    const std::set<std::string>  &arrayNames
+)
+{
+    std::map<uint32_t, const TABLE_ENTRY *> byCrc;
+    std::map<uint32_t, std::string> byCrcTable;
+    std::set<std::string> used;
+
+    for (size_t t = 0 ; t < tables.size() ; t++)
+    {
+        const ROM_TABLE &table = tables[t];
+        const char *name = table.name.c_str();
+
+        for (size_t e = 0 ; e < table.entries.size() ; e++)
+        {
+            const TABLE_ENTRY &entry = table.entries[e];
+            unsigned samples = romSampleCount(entry.length);
+
+            used.insert(entry.data2nName);
+
+            if (entry.data2n.size() < samples)
+            {
+                report(true, "%s %s: %s has %u samples, a 0x%X byte ROM needs %u",
+                       name, entry.location.c_str(), entry.data2nName.c_str(), (unsigned) entry.data2n.size(), entry.length, samples);
+            }
+
+            for (size_t i = 0 ; i < entry.data2n.size() ; i++)
+            {
+                if (entry.data2n[i] > 0xFF)
+                {
+                    report(true, "%s %s: %s[%u] is 0x%X - wider than the data bus",
+                           name, entry.location.c_str(), entry.data2nName.c_str(), (unsigned) i, entry.data2n[i]);
+                }
+            }
+
+            for (size_t o = 0 ; o < e ; o++)
+            {
+                if ((table.entries[o].bankSwitch == entry.bankSwitch) && (table.entries[o].start == entry.start))
+                {
+                    report(true, "%s %s: socket at 0x%04X listed twice", name, entry.location.c_str(), entry.start);
+                }
+            }
+
+            std::map<uint32_t, const TABLE_ENTRY *>::const_iterator same = byCrc.find(entry.crc);
+
+            if (same == byCrc.end())
+            {
+                byCrc[entry.crc] = &entry;
+                byCrcTable[entry.crc] = table.name;
+            }
+            else
+            {
+                size_t count = std::min(same->second->data2n.size(), entry.data2n.size());
+
+                if (!std::equal(entry.data2n.begin(), entry.data2n.begin() + count, same->second->data2n.begin()))
+                {
+                    report(true, "%s %s: CRC 0x%08X has samples %s here and %s in %s",
+                           name, entry.location.c_str(), entry.crc, entry.data2nName.c_str(),
+                           same->second->data2nName.c_str(), byCrcTable[entry.crc].c_str());
+                }
+            }
+        }
+    }
+
+    //
+    // A table whose every ROM has the samples of another table's ROM but not its CRC
+    // is most likely a copy waiting for its real samples.
+    //
+    for (size_t t = 0 ; t < tables.size() ; t++)
+    {
+        for (size_t u = t + 1 ; u < tables.size() ; u++)
+        {
+            const ROM_TABLE &a = tables[t];
+            const ROM_TABLE &b = tables[u];
+            size_t copies = 0;
+
+            for (size_t e = 0 ; e < a.entries.size() ; e++)
+            {
+                for (size_t f = 0 ; f < b.entries.size() ; f++)
+                {
+                    if ((a.entries[e].crc != b.entries[f].crc) &&
+                        (a.entries[e].length == b.entries[f].length) &&
+                        (a.entries[e].data2n == b.entries[f].data2n))
+                    {
+                        copies++;
+                        break;
+                    }
+                }
+            }
+
+            if ((copies >= 2) && (copies == a.entries.size()))
+            {
+                report(false, "%s: the samples of all %u ROMs are those of %s under other CRCs - placeholder?",
+                       a.name.c_str(), (unsigned) copies, b.name.c_str());
+            }
+            else if ((copies >= 2) && (copies == b.entries.size()))
+            {
+                report(false, "%s: the samples of all %u ROMs are those of %s under other CRCs - placeholder?",
+                       b.name.c_str(), (unsigned) copies, a.name.c_str());
+            }
+        }
+    }
+
+    for (std::set<std::string>::const_iterator name = arrayNames.begin() ; name != arrayNames.end() ; ++name)
+    {
+        if (used.find(*name) == used.end())
+        {
+            report(false, "%s is not used by any table", name->c_str());
+        }
+    }
+}
+
+//
+// Index every image of the rompath, and every slice of the lengths the tables use,
+// by CRC. CRCs are computed on every core.
+//
+static void
+indexImages(
+    const std::vector<ROM_FILE> &files,
+    const std::set<uint32_t>    &lengths,
+    std::vector<IMAGE_SLICE>    *slices
+)
+{
+    for (size_t f = 0 ; f < files.size() ; f++)
+    {
+        IMAGE_SLICE whole = {&files[f], 0, (uint32_t) files[f].size, 0};
+
+        slices->push_back(whole);
+
+        for (std::set<uint32_t>::const_iterator length = lengths.begin() ; length != lengths.end() ; ++length)
+        {
+            if ((*length < files[f].size) && ((files[f].size % *length) == 0))
+            {
+                for (uint32_t offset = 0 ; offset < files[f].size ; offset += *length)
+                {
+                    IMAGE_SLICE slice = {&files[f], offset, *length, 0};
+
+                    slices->push_back(slice);
+                }
+            }
+        }
+    }
+
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (unsigned t = 0 ; t < std::min<size_t>(threads, slices->size()) ; t++)
+    {
+        workers.push_back(std::thread([slices, &next]()
+        {
+            for (size_t s = next++ ; s < slices->size() ; s = next++)
+            {
+                IMAGE_SLICE &slice = (*slices)[s];
+
+                slice.crc = romCrc32(slice.file->data + slice.offset, slice.length);
+            }
+        }));
+    }
+
+    for (size_t t = 0 ; t < workers.size() ; t++)
+    {
+        workers[t].join();
+    }
+}
+
+static std::string
+sliceName(
+    const IMAGE_SLICE &slice
+)
+{
+    char buffer[32];
+
+    if (slice.length == slice.file->size)
+    {
+        return slice.file->path;
+    }
+
+    snprintf(buffer, sizeof(buffer), " +0x%X", slice.offset);
+
+    return slice.file->path + buffer;
+}
+
+static bool
+samplesMatch(
+    const TABLE_ENTRY &entry,
+    const IMAGE_SLICE &slice,
+    unsigned          *first
+)
+{
+    unsigned count = std::min((unsigned) entry.data2n.size(), romSampleCount(slice.length));
+
+    for (unsigned i = 0 ; i < count ; i++)
+    {
+        if (entry.data2n[i] != slice.file->data[slice.offset + (1UL << i)])
+        {
+            *first = i;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void
+checkImages(
+    const std::vector<ROM_TABLE> &tables,
+    const std::vector<ROM_FILE>  &files,
+    unsigned                     *found,
+    unsigned                     *missing
+)
+{
+    std::set<uint32_t> lengths;
+    std::vector<IMAGE_SLICE> slices;
+    std::multimap<uint32_t, const IMAGE_SLICE *> byCrc;
+    std::set<const ROM_FILE *> referenced;
+    std::set<std::string> romsets;
+    std::set<uint32_t> listed;
+    std::set<std::pair<uint32_t, std::string> > checked;
+
+    for (size_t t = 0 ; t < tables.size() ; t++)
+    {
+        for (size_t e = 0 ; e < tables[t].entries.size() ; e++)
+        {
+            lengths.insert(tables[t].entries[e].length);
+            listed.insert(tables[t].entries[e].crc);
+        }
+    }
+
+    indexImages(files, lengths, &slices);
+
+    for (size_t s = 0 ; s < slices.size() ; s++)
+    {
+        byCrc.insert(std::make_pair(slices[s].crc, &slices[s]));
+    }
+
+    for (size_t t = 0 ; t < tables.size() ; t++)
+    {
+        const ROM_TABLE &table = tables[t];
+
+        for (size_t e = 0 ; e < table.entries.size() ; e++)
+        {
+            const TABLE_ENTRY &entry = table.entries[e];
+            const IMAGE_SLICE *image = NULL;
+            unsigned first;
+
+            //
+            // A ROM shared by several sets is checked with the first.
+            //
+            if (!checked.insert(std::make_pair(entry.crc, entry.data2nName)).second)
+            {
+                continue;
+            }
+
+            for (std::multimap<uint32_t, const IMAGE_SLICE *>::const_iterator it = byCrc.lower_bound(entry.crc) ;
+                 (it != byCrc.end()) && (it->first == entry.crc) ;
+                 ++it)
+            {
+                if (it->second->length == entry.length)
+                {
+                    image = it->second;
+                    break;
+                }
+            }
+
+            if (image != NULL)
+            {
+                (*found)++;
+                referenced.insert(image->file);
+
+                std::string path = image->file->path;
+                romsets.insert(path.substr(0, path.find_last_of('/')));
+
+                if (!samplesMatch(entry, *image, &first))
+                {
+                    report(true, "%s %s: %s[%u] is 0x%02X, %s has 0x%02X",
+                           table.name.c_str(), entry.location.c_str(), entry.data2nName.c_str(), first,
+                           entry.data2n[first], sliceName(*image).c_str(), image->file->data[image->offset + (1UL << first)]);
+                }
+
+                continue;
+            }
+
+            //
+            // Not found by CRC - an image with the same samples that no other entry
+            // claims means the CRC is wrong.
+            //
+            for (size_t s = 0 ; s < slices.size() ; s++)
+            {
+                if ((slices[s].length == entry.length) &&
+                    (listed.find(slices[s].crc) == listed.end()) &&
+                    samplesMatch(entry, slices[s], &first))
+                {
+                    image = &slices[s];
+                    break;
+                }
+            }
+
+            if (image != NULL)
+            {
+                report(true, "%s %s: CRC 0x%08X not found - samples match %s, CRC 0x%08X",
+                       table.name.c_str(), entry.location.c_str(), entry.crc, sliceName(*image).c_str(), image->crc);
+            }
+            else
+            {
+                (*missing)++;
+            }
+        }
+    }
+
+    //
+    // Images of the romsets the tables use that are in no table.
+    //
+    for (size_t s = 0 ; s < slices.size() ; s++)
+    {
+        const IMAGE_SLICE &slice = slices[s];
+        std::string path = slice.file->path;
+
+        if ((slice.length == slice.file->size) &&
+            (referenced.find(slice.file) == referenced.end()) &&
+            (romsets.find(path.substr(0, path.find_last_of('/'))) != romsets.end()) &&
+            (listed.find(slice.crc) == listed.end()))
+        {
+            report(false, "%s (0x%08X) is not in any table", path.c_str(), slice.crc);
+        }
+    }
+}
+
+static void
+usage(
+)
+{
+    fprintf(stderr, "Usage: rom_table_verify [-s source root] [rompath]\n");
+    exit(2);
+}
+
+int
+main(
+    int  argc,
+    char *argv[]
+)
+{
+    std::string root(".");
+    std::vector<std::string> directories;
+    std::vector<ROM_TABLE> tables;
+    std::set<std::string> arrayNames;
+    unsigned found = 0;
+    unsigned missing = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "s:")) != -1)
+    {
+        switch (opt)
+        {
+            case 's' : root = optarg; break;
+            default  : usage();
+        }
+    }
+
+    if (argc - optind > 1)
+    {
+        usage();
+    }
+
+    //
+    // Every CPU directory - its headers first so their constants reach each source.
+    //
+    DIR *dir = opendir(root.c_str());
+    struct dirent *entry;
+
+    while ((dir != NULL) && ((entry = readdir(dir)) != NULL))
+    {
+        std::string name(entry->d_name);
+
+        if ((name.size() > 4) && (name[0] == 'C') && (name.compare(name.size() - 3, 3, "Cpu") == 0))
+        {
+            directories.push_back(root + "/" + name);
+        }
+    }
+
+    if (dir != NULL)
+    {
+        closedir(dir);
+    }
+
+    std::sort(directories.begin(), directories.end());
+
+    for (size_t d = 0 ; d < directories.size() ; d++)
+    {
+        std::vector<std::string> files;
+        SOURCE_SCOPE headers;
+
+        romListDirectory(directories[d], false, &files);
+
+        for (size_t f = 0 ; f < files.size() ; f++)
+        {
+            if (files[f].compare(files[f].size() - 2, 2, ".h") == 0)
+            {
+                parseSource(files[f], &headers, NULL);
+            }
+        }
+
+        for (size_t f = 0 ; f < files.size() ; f++)
+        {
+            if (files[f].compare(files[f].size() - 4, 4, ".cpp") == 0)
+            {
+                SOURCE_SCOPE scope(headers);
+                size_t first = tables.size();
+
+                parseSource(files[f], &scope, &tables);
+                resolveTables(scope, &tables, first);
+
+                for (std::map<std::string, std::vector<uint32_t> >::const_iterator array = scope.arrays.begin() ;
+                     array != scope.arrays.end() ;
+                     ++array)
+                {
+                    if ((first != tables.size()) && (headers.arrays.find(array->first) == headers.arrays.end()))
+                    {
+                        arrayNames.insert(array->first);
+                    }
+                }
+            }
+        }
+    }
+
+    if (tables.empty())
+    {
+        fprintf(stderr, "No ROM_REGION tables under %s\n", root.c_str());
+        return 2;
+    }
+
+    //
+    // Qualify the table names with their game for the report.
+    //
+    for (size_t t = 0 ; t < tables.size() ; t++)
+    {
+        std::string file = romBaseName(tables[t].file);
+
+        tables[t].name = file.substr(0, file.size() - 4) + " " + tables[t].name;
+    }
+
+    checkSources(tables, arrayNames);
+
+    if (optind < argc)
+    {
+        std::vector<std::string> paths;
+        std::vector<ROM_FILE> files;
+
+        romListDirectory(argv[optind], true, &paths);
+
+        for (size_t p = 0 ; p < paths.size() ; p++)
+        {
+            ROM_FILE file;
+
+            if (romMapFile(paths[p], &file))
+            {
+                files.push_back(file);
+            }
+        }
+
+        checkImages(tables, files, &found, &missing);
+
+        for (size_t f = 0 ; f < files.size() ; f++)
+        {
+            romUnmapFile(&files[f]);
+        }
+    }
+
+    unsigned entries = 0;
+
+    for (size_t t = 0 ; t < tables.size() ; t++)
+    {
+        entries += (unsigned) tables[t].entries.size();
+    }
+
+    printf("%u tables, %u ROMs", (unsigned) tables.size(), entries);
+
+    if (optind < argc)
+    {
+        printf(", %u found in %s, %u not found", found, argv[optind], missing);
+    }
+
+    printf(": %u errors, %u warnings\n", s_errors, s_warnings);
+
+    return (s_errors == 0) ? 0 : 1;
+}